@@ -11,6 +11,7 @@
 
 #include "Port.h"
 #include "Port_Regs.h"
+#include "Port_PinMux.h"
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -27,6 +28,458 @@
 STATIC const Port_ConfigType* Port_PinConfigPtr = NULL_PTR;
 STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 
+/* Registers base address of every port, indexed by the port number */
+STATIC const uint32 Port_BaseAddress[PORT_NUMBER_OF_PORTS] =
+{
+  GPIO_PORTA_BASE_ADDRESS,
+  GPIO_PORTB_BASE_ADDRESS,
+  GPIO_PORTC_BASE_ADDRESS,
+  GPIO_PORTD_BASE_ADDRESS,
+  GPIO_PORTE_BASE_ADDRESS,
+  GPIO_PORTF_BASE_ADDRESS,
+};
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+
+/* RAM copy of the runtime configurable registers of every used port, loaded by Port_Init */
+STATIC Port_ShadowType Port_Shadow[PORT_NUMBER_OF_PORTS];
+
+/* Updates the MASK bits of the shadow FIELD and stores the whole register from it, no read of the register.
+ * A plain read-modify-write of the shadow, the register store sits between its load and store */
+#define PORT_UPDATE_REG(PORT_NUM,FIELD,OFFSET,MASK,VALUE) \
+  do { uint32 Port_Shadow_Value = (Port_Shadow[PORT_NUM].FIELD & ~(uint32)(MASK)) | ((uint32)(VALUE) & (uint32)(MASK)); \
+       PORT_WRITE_REG(Port_BaseAddress[PORT_NUM] + (OFFSET) , Port_Shadow_Value); \
+       Port_Shadow[PORT_NUM].FIELD = Port_Shadow_Value; } while(0)
+
+/* Loads the shadow of port Port_Num from its registers */
+STATIC void Port_LoadShadow( uint8 Port_Num )
+{
+  uint32 PortGpio_Base = Port_BaseAddress[Port_Num];
+  Port_ShadowType * Shadow = &Port_Shadow[Port_Num];
+  
+  Shadow->Dir   = PORT_READ_REG(PortGpio_Base + PORT_DIR_REG_OFFSET);
+  Shadow->Den   = PORT_READ_REG(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET);
+  Shadow->Afsel = PORT_READ_REG(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET);
+  Shadow->Amsel = PORT_READ_REG(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET);
+  Shadow->Pctl  = PORT_READ_REG(PortGpio_Base + PORT_CTL_REG_OFFSET);
+  Shadow->Pur   = PORT_READ_REG(PortGpio_Base + PORT_PULL_UP_REG_OFFSET);
+  Shadow->Pdr   = PORT_READ_REG(PortGpio_Base + PORT_PULL_DOWN_REG_OFFSET);
+  Shadow->Odr   = PORT_READ_REG(PortGpio_Base + PORT_OPEN_DRAIN_REG_OFFSET);
+}
+
+/* Shadow of the register at Offset of port Port_Num, NULL_PTR for the registers that are not shadowed */
+STATIC uint32 * Port_ShadowOf( uint8 Port_Num, uint16 Offset )
+{
+  Port_ShadowType * Shadow = &Port_Shadow[Port_Num];
+  
+  switch(Offset)
+  {
+    case PORT_DIR_REG_OFFSET:               return &Shadow->Dir;
+    case PORT_DIGITAL_ENABLE_REG_OFFSET:    return &Shadow->Den;
+    case PORT_ALT_FUNC_REG_OFFSET:          return &Shadow->Afsel;
+    case PORT_ANALOG_MODE_SEL_REG_OFFSET:   return &Shadow->Amsel;
+    case PORT_CTL_REG_OFFSET:               return &Shadow->Pctl;
+    case PORT_PULL_UP_REG_OFFSET:           return &Shadow->Pur;
+    case PORT_PULL_DOWN_REG_OFFSET:         return &Shadow->Pdr;
+    case PORT_OPEN_DRAIN_REG_OFFSET:        return &Shadow->Odr;
+    default:                                return NULL_PTR;
+  }
+}
+
+/* Stores a whole register and its shadow FIELD */
+#define PORT_STORE_REG(PORT_NUM,FIELD,OFFSET,VALUE) \
+  do { Port_Shadow[PORT_NUM].FIELD = (uint32)(VALUE); \
+       PORT_WRITE_REG(Port_BaseAddress[PORT_NUM] + (OFFSET) , Port_Shadow[PORT_NUM].FIELD); } while(0)
+
+#else
+
+#define PORT_UPDATE_REG(PORT_NUM,FIELD,OFFSET,MASK,VALUE) \
+  PORT_WRITE_REG_MASKED(Port_BaseAddress[PORT_NUM] + (OFFSET) , (MASK) , (VALUE))
+
+#define PORT_STORE_REG(PORT_NUM,FIELD,OFFSET,VALUE) \
+  PORT_WRITE_REG(Port_BaseAddress[PORT_NUM] + (OFFSET) , (VALUE))
+
+#endif
+
+#if (PORT_MAIN_FUNCTION_API == STD_ON)
+
+/* Register updates of the reentrant APIs in progress on every port. The shadow and the register differ
+ * inside such an update, Port_MainFunction leaves the port to its next call instead of repairing it */
+STATIC volatile uint32 Port_UpdatesInProgress[PORT_NUMBER_OF_PORTS];
+
+#if (PORT_LOCK_FREE_UPDATES == STD_ON)
+#define PORT_UPDATE_BEGIN(PORT_NUM)       PORT_ATOMIC_ADD_WORD((uint32 *)&Port_UpdatesInProgress[PORT_NUM] , 1U)
+#define PORT_UPDATE_END(PORT_NUM)         PORT_ATOMIC_ADD_WORD((uint32 *)&Port_UpdatesInProgress[PORT_NUM] , ~(uint32)0)
+#else
+/* The pin APIs are called from one context only */
+#define PORT_UPDATE_BEGIN(PORT_NUM)       (Port_UpdatesInProgress[PORT_NUM]++)
+#define PORT_UPDATE_END(PORT_NUM)         (Port_UpdatesInProgress[PORT_NUM]--)
+#endif
+
+#else
+
+#define PORT_UPDATE_BEGIN(PORT_NUM)
+#define PORT_UPDATE_END(PORT_NUM)
+
+#endif
+
+#if (PORT_LOCK_FREE_UPDATES == STD_ON)
+
+/* Interrupt safe PORT_UPDATE_REG of the reentrant APIs: the shadow word and the register are each updated
+ * with an exclusive load/store retry loop, an interrupt changing other pins of the same port is never lost.
+ * The register is read back again, two contexts changing the same pin at once is still not ordered */
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+#define PORT_ATOMIC_UPDATE_REG(PORT_NUM,FIELD,OFFSET,MASK,VALUE) \
+  do { PORT_UPDATE_BEGIN(PORT_NUM); \
+       PORT_ATOMIC_WRITE_WORD_MASKED(&Port_Shadow[PORT_NUM].FIELD , (MASK) , (VALUE)); \
+       PORT_ATOMIC_WRITE_REG_MASKED(Port_BaseAddress[PORT_NUM] + (OFFSET) , (MASK) , (VALUE)); \
+       PORT_UPDATE_END(PORT_NUM); } while(0)
+#else
+/* A single exclusive store, Port_MainFunction cannot see the update half done */
+#define PORT_ATOMIC_UPDATE_REG(PORT_NUM,FIELD,OFFSET,MASK,VALUE) \
+  PORT_ATOMIC_WRITE_REG_MASKED(Port_BaseAddress[PORT_NUM] + (OFFSET) , (MASK) , (VALUE))
+#endif
+
+#else
+
+#define PORT_ATOMIC_UPDATE_REG(PORT_NUM,FIELD,OFFSET,MASK,VALUE) \
+  do { PORT_UPDATE_BEGIN(PORT_NUM); \
+       PORT_UPDATE_REG(PORT_NUM , FIELD , OFFSET , MASK , VALUE); \
+       PORT_UPDATE_END(PORT_NUM); } while(0)
+
+#endif
+
+#if (PORT_STATISTICS_API == STD_ON)
+
+STATIC Port_StatisticsType Port_Statistics;
+
+/* Adds one completed call of the API ApiId that lasted Duration time stamp units, with interrupts masked
+ * since the reentrant APIs also record from interrupts and Total does not fit an exclusive access */
+STATIC void Port_RecordStatistics( uint8 ApiId, uint32 Duration )
+{
+  Port_ApiStatisticsType * Api = &Port_Statistics.Api[ApiId];
+  
+  PORT_ENTER_CRITICAL();
+  
+  if((Api->Calls == 0) || (Duration < Api->Min))
+  {
+    Api->Min = Duration;
+  }
+  if(Duration > Api->Max)
+  {
+    Api->Max = Duration;
+  }
+  Api->Total += Duration;
+  Api->Calls++;
+  
+  PORT_EXIT_CRITICAL();
+}
+
+#define PORT_STATISTICS_START(SID)        uint32 Port_Start_Time = PORT_TIMESTAMP()
+#define PORT_STATISTICS_STOP(SID)         Port_RecordStatistics((SID), PORT_TIMESTAMP() - Port_Start_Time)
+
+#else
+
+#define PORT_STATISTICS_START(SID)
+#define PORT_STATISTICS_STOP(SID)
+
+#endif
+
+/* Pins of the configuration that Port_Init configured, the protected JTAG pins are not and stay untouched at runtime */
+#define PORT_PIN_OWNED(PIN) \
+  ((Port_PinConfigPtr->Port[PORT_PIN_CFG_PORT_NUM(Port_PinConfigPtr->Pin[PIN])].Mask & Port_PinConfigPtr->Pin_Desc[PIN].Mask) != 0U)
+
+/* Pins currently driven as outputs, taken from the shadow when there is one */
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+#define PORT_PORT_OUTPUTS(PORT_NUM)       (Port_Shadow[PORT_NUM].Dir)
+#else
+#define PORT_PORT_OUTPUTS(PORT_NUM)       PORT_READ_REG(Port_BaseAddress[PORT_NUM] + PORT_DIR_REG_OFFSET)
+#endif
+#define PORT_PIN_IS_OUTPUT(PIN) \
+  ((PORT_PORT_OUTPUTS(PORT_PIN_CFG_PORT_NUM(Port_PinConfigPtr->Pin[PIN])) & Port_PinConfigPtr->Pin_Desc[PIN].Mask) != 0U)
+
+/* GPIODATA address masked to a pin and bit-band alias word of its GPIODIR bit, derived from the port base address */
+#define PORT_PIN_BASE_ADDRESS(PIN)        Port_BaseAddress[PORT_PIN_CFG_PORT_NUM(Port_PinConfigPtr->Pin[PIN])]
+#define PORT_PIN_DATA_ADDRESS(PIN)        PORT_DATA_MASKED_ADDRESS(PORT_PIN_BASE_ADDRESS(PIN) , Port_PinConfigPtr->Pin_Desc[PIN].Mask)
+#define PORT_PIN_DIR_ALIAS(PIN)           PORT_BIT_BAND_ALIAS(PORT_PIN_BASE_ADDRESS(PIN) + PORT_DIR_REG_OFFSET , PORT_PIN_CFG_PIN_NUM(Port_PinConfigPtr->Pin[PIN]))
+
+#if (PORT_MAIN_FUNCTION_API == STD_ON)
+
+/* Next register checked by Port_MainFunction: port and index in the per port register list */
+STATIC uint8 Port_MainPort = 0;
+STATIC uint8 Port_MainRegister = 0;
+
+/* PORT_SHADOW_DRIFT_xxx bits of the registers repaired by Port_MainFunction, read by Port_GetMainFunctionDrift */
+STATIC uint8 Port_MainDrift[PORT_NUMBER_OF_PORTS];
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+/* Every shadowed register is checked, in the order of the PORT_SHADOW_DRIFT_xxx bits */
+#define PORT_MAIN_REGISTERS_PER_PORT      (8U)
+
+STATIC const uint16 Port_MainRegisterOffset[PORT_MAIN_REGISTERS_PER_PORT] =
+{
+  PORT_DIR_REG_OFFSET,
+  PORT_DIGITAL_ENABLE_REG_OFFSET,
+  PORT_ALT_FUNC_REG_OFFSET,
+  PORT_ANALOG_MODE_SEL_REG_OFFSET,
+  PORT_CTL_REG_OFFSET,
+  PORT_PULL_UP_REG_OFFSET,
+  PORT_PULL_DOWN_REG_OFFSET,
+  PORT_OPEN_DRAIN_REG_OFFSET,
+};
+#else
+/* Without shadow only GPIODIR has a known content, the bits of the pins with an unchangeable direction */
+#define PORT_MAIN_REGISTERS_PER_PORT      (1U)
+#endif
+
+#endif
+
+/* Hooks around the body of every API, after its development error checks, compiled away unless instrumented */
+#define PORT_API_ENTER(SID)               PORT_SIM_API_ENTER(SID); PORT_STATISTICS_START(SID)
+#define PORT_API_EXIT(SID)                PORT_STATISTICS_STOP(SID); PORT_SIM_API_EXIT(SID)
+
+/* Pin multiplexing entry of Mode for the pin Pin: PMCx value, with PORT_PINMUX_VALID set if the pin supports the mode */
+STATIC uint8 Port_PinMuxEntry( Pin_Config Pin, Port_PinModeType Mode )
+{
+  return (Mode <= PORT_PIN_MODE_GPIO) ? PORT_PINMUX_ENTRY(PORT_PIN_CFG_PORT_NUM(Pin), PORT_PIN_CFG_PIN_NUM(Pin), Mode) : 0U;
+}
+
+/* Puts the pins Mask of port Port_Num in Mode with one interrupt safe update of each mode register,
+ * Pctl_Mask holds the PMCx fields of the same pins and Pctl their values for an alternate function */
+STATIC void Port_WritePinsMode( uint8 Port_Num, uint32 Mask, uint32 Pctl_Mask, uint32 Pctl, Port_PinModeType Mode )
+{
+  switch(Mode)
+  {
+    case PORT_PIN_MODE_ADC:
+        
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Amsel , PORT_ANALOG_MODE_SEL_REG_OFFSET , Mask , Mask);      /* Set the corresponding bits in the GPIOAMSEL register to enable analog functionality on these pins */
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Den , PORT_DIGITAL_ENABLE_REG_OFFSET , Mask , 0);          /* Clear the corresponding bits in the GPIODEN register to disable digital functionality on these pins */
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Afsel , PORT_ALT_FUNC_REG_OFFSET , Mask , Mask);             /* Enable Alternative function for these pins by setting the corresponding bits in GPIOAFSEL register */
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Pctl , PORT_CTL_REG_OFFSET , Pctl_Mask , 0);                /* Clear the PMCx bits for these pins, the analog signals do not go through the mux */
+    break;
+        
+    case PORT_PIN_MODE_ALT1:
+    case PORT_PIN_MODE_ALT2:
+    case PORT_PIN_MODE_ALT3:
+    case PORT_PIN_MODE_ALT4:
+    case PORT_PIN_MODE_ALT5:
+    case PORT_PIN_MODE_ALT6:
+    case PORT_PIN_MODE_ALT7:
+    case PORT_PIN_MODE_ALT8:
+    case PORT_PIN_MODE_ALT9:
+        
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Amsel , PORT_ANALOG_MODE_SEL_REG_OFFSET , Mask , 0);           /* Clear the corresponding bits in the GPIOAMSEL register to disable analog functionality on these pins */
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Den , PORT_DIGITAL_ENABLE_REG_OFFSET , Mask , Mask);         /* Set the corresponding bits in the GPIODEN register to enable digital functionality on these pins */
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Afsel , PORT_ALT_FUNC_REG_OFFSET , Mask , Mask);               /* Enable Alternative function for these pins by setting the corresponding bits in GPIOAFSEL register */
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Pctl , PORT_CTL_REG_OFFSET , Pctl_Mask , Pctl);               /* Select the alternate function of these pins in their PMCx bits */
+    break;
+        
+    case PORT_PIN_MODE_GPIO:
+        
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Amsel , PORT_ANALOG_MODE_SEL_REG_OFFSET , Mask , 0);           /* Clear the corresponding bits in the GPIOAMSEL register to disable analog functionality on these pins */
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Den , PORT_DIGITAL_ENABLE_REG_OFFSET , Mask , Mask);         /* Set the corresponding bits in the GPIODEN register to enable digital functionality on these pins */
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Afsel , PORT_ALT_FUNC_REG_OFFSET , Mask , 0);                  /* Disable Alternative function for these pins by clearing the corresponding bits in GPIOAFSEL register */
+        PORT_ATOMIC_UPDATE_REG(Port_Num , Pctl , PORT_CTL_REG_OFFSET , Pctl_Mask , 0);                  /* Clear the PMCx bits for these pins */
+    break;
+    
+    default:
+        /* Do Nothing ... Unknown mode */
+    break;
+  }
+}
+
+/* Enables the clocks of the ports Clock_Mask with one write and waits once until all of them are ready to be accessed */
+STATIC void Port_EnableClocks( uint32 Clock_Mask )
+{
+  PORT_WRITE_REG(SYSCTL_RCGCGPIO_REG_ADDRESS , PORT_READ_REG(SYSCTL_RCGCGPIO_REG_ADDRESS) | Clock_Mask);
+  
+  while((PORT_READ_REG(SYSCTL_PRGPIO_REG_ADDRESS) & Clock_Mask) != Clock_Mask)
+  {
+    /* Do Nothing */
+  }
+  
+#if (PORT_AHB_APERTURE == STD_ON)
+  /* Move the ports to the AHB aperture before any of their registers is accessed */
+  PORT_WRITE_REG(SYSCTL_GPIOHBCTL_REG_ADDRESS , PORT_READ_REG(SYSCTL_GPIOHBCTL_REG_ADDRESS) | Clock_Mask);
+#endif
+}
+
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+
+/* NVIC interrupt numbers of the GPIO ports A to F */
+STATIC const uint8 Port_IrqNumber[PORT_NUMBER_OF_PORTS] = { 0U, 1U, 2U, 3U, 4U, 30U };
+
+/* Programs the interrupt sense and arming of port Port_Num with one store per register, no read */
+STATIC void Port_WriteIrqImage( uint8 Port_Num, const Port_IrqImageType * Irq )
+{
+  uint32 PortGpio_Base = Port_BaseAddress[Port_Num];
+  
+  /* Disarm first, changing the sense of an armed pin can raise a false interrupt */
+  PORT_WRITE_REG(PortGpio_Base + PORT_INT_MASK_REG_OFFSET , 0U);
+  
+  if(Irq->Im != 0)
+  {
+    PORT_WRITE_REG(PortGpio_Base + PORT_INT_SENSE_REG_OFFSET , Irq->Is);
+    PORT_WRITE_REG(PortGpio_Base + PORT_INT_BOTH_EDGES_REG_OFFSET , Irq->Ibe);
+    PORT_WRITE_REG(PortGpio_Base + PORT_INT_EVENT_REG_OFFSET , Irq->Iev);
+    PORT_WRITE_REG(PortGpio_Base + PORT_INT_CLEAR_REG_OFFSET , Irq->Im);     /* Drop the edges latched with the previous sense */
+    PORT_WRITE_REG(PortGpio_Base + PORT_INT_MASK_REG_OFFSET , Irq->Im);
+  }
+  else
+  {
+    /* Do Nothing ... No armed pin on this port */
+  }
+}
+
+/* Enables in the NVIC the vectors of the ports with armed pins with one store, the others are left as they are */
+STATIC void Port_EnableInterrupts( const Port_ConfigType * ConfigPtr )
+{
+  uint32 Enable = 0;
+  
+  for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+  {
+    if(ConfigPtr->Irq[Port_Num].Im != 0)
+    {
+      Enable |= (uint32)1 << Port_IrqNumber[Port_Num];
+    }
+  }
+  
+  if(Enable != 0)
+  {
+    PORT_WRITE_REG(NVIC_EN0_REG_ADDRESS , Enable);
+  }
+}
+
+/* Calls the notifications of the pending pins of port Port_Num, highest pin first. Each pending pin is found
+ * with one CLZ of GPIOMIS, the cost depends on the pending pins only, not on the number of armed pins */
+STATIC void Port_DispatchIrq( uint8 Port_Num )
+{
+  uint32 PortGpio_Base = Port_BaseAddress[Port_Num];
+  
+  PORT_API_ENTER(Port_Isr_SID);
+  
+  uint32 Pending = PORT_READ_REG(PortGpio_Base + PORT_MASKED_INT_STATUS_REG_OFFSET);
+  
+  /* Acknowledge before the notifications run, an edge during them raises a new interrupt */
+  PORT_WRITE_REG(PortGpio_Base + PORT_INT_CLEAR_REG_OFFSET , Pending);
+  
+  while(Pending != 0)
+  {
+    uint8 Pin_Num = (uint8)(31U - PORT_CLZ(Pending));
+    Port_PinNotificationType Notification = Port_PinNotifications[Port_Num][Pin_Num];
+    
+    Pending &= ~((uint32)1 << Pin_Num);
+    if(Notification != NULL_PTR)
+    {
+      Notification();
+    }
+    else
+    {
+      /* Do Nothing ... Armed pin without notification */
+    }
+  }
+  
+  PORT_API_EXIT(Port_Isr_SID);
+}
+
+#endif
+
+#if (PORT_DEBOUNCE_API == STD_ON)
+
+/* Debouncing state of every port, loaded by Port_Init and Port_SwitchConfig */
+STATIC Port_DebounceStateType Port_Debounce[PORT_NUMBER_OF_PORTS];
+
+/* Takes the current levels of the debounced pins of ConfigPtr as their debounced levels, one read per sampled port */
+STATIC void Port_ResetDebounce( const Port_ConfigType * ConfigPtr )
+{
+  for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+  {
+    const Port_DebounceImageType * Image = &ConfigPtr->Debounce[Port_Num];
+    Port_DebounceStateType * Debounce = &Port_Debounce[Port_Num];
+    
+    Debounce->Level = (Image->Mask != 0) ? (PORT_READ_REG(ConfigPtr->Group[Port_Num].Data_Address) & Image->Mask) : 0U;
+    Debounce->Count0 = Image->Reload0;
+    Debounce->Count1 = Image->Reload1;
+    Debounce->Count2 = Image->Reload2;
+  }
+}
+
+#endif
+
+#if (PORT_SNAPSHOT_API == STD_ON)
+
+/* Last two images of Port_Snapshot, compared by Port_GetEdges */
+STATIC uint64 Port_SnapshotCurrent = 0;
+STATIC uint64 Port_SnapshotPrevious = 0;
+
+/* FALSE until the first Port_Snapshot after Port_Init or Port_SwitchConfig, which reports no edge */
+STATIC boolean Port_SnapshotTaken = FALSE;
+
+#endif
+
+/* Applies one precomputed register update of a configuration switch */
+STATIC void Port_ApplyDelta( const Port_RegDeltaType * Delta )
+{
+  uint32 Address = Port_BaseAddress[Delta->Port_Num] + Delta->Offset;
+  
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+  uint32 * Shadow = Port_ShadowOf(Delta->Port_Num, Delta->Offset);
+  
+  if(Shadow != NULL_PTR)
+  {
+    /* Shadowed register, stored from its updated shadow without being read */
+    *Shadow = (*Shadow & ~Delta->Mask) | (Delta->Value & Delta->Mask);
+    PORT_WRITE_REG(Address , *Shadow);
+    return;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+#endif
+  
+  if(Delta->Mask == 0xFFFFFFFFU)
+  {
+    PORT_WRITE_REG(Address , Delta->Value);     /* GPIODATA masked store or GPIOLOCK key */
+  }
+  else
+  {
+    PORT_WRITE_REG_MASKED(Address , Delta->Mask , Delta->Value);
+  }
+}
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+/* Writes the MASK bits of a register from VALUE only if its shadow FIELD holds other ones */
+#define PORT_RESTORE_REG(PORT_NUM,FIELD,OFFSET,MASK,VALUE) \
+  do { if(((Port_Shadow[PORT_NUM].FIELD ^ (uint32)(VALUE)) & (uint32)(MASK)) != 0U) \
+       { PORT_UPDATE_REG(PORT_NUM , FIELD , OFFSET , MASK , VALUE); } } while(0)
+#else
+#define PORT_RESTORE_REG(PORT_NUM,FIELD,OFFSET,MASK,VALUE) \
+  do { if((uint32)(MASK) != 0U) \
+       { PORT_UPDATE_REG(PORT_NUM , FIELD , OFFSET , MASK , VALUE); } } while(0)
+#endif
+
+/* Takes the pins of ConfigPtr whose direction or mode can be changed at runtime back to their configured
+ * direction and mode. The deltas of a configuration switch only write the bits that differ between the two
+ * sets, a pin changed by Port_SetPinDirection(s) or Port_SetPinMode(s) would otherwise keep its runtime state */
+STATIC void Port_RestoreChangeable( const Port_ConfigType * ConfigPtr )
+{
+  for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+  {
+    const Port_PortImage * Image = &ConfigPtr->Port[Port_Num];
+    uint32 Dir_Mask = Image->Mask & ~Image->Dir_Locked;
+    uint32 Mode_Mask = Image->Mask & ~Image->Mode_Locked;
+    uint32 Pctl_Mask = Image->Pctl_Mask & ~Image->Pctl_Locked;
+    
+    /* Same register order as Port_Init, no write at all for the registers already holding the configured bits */
+    PORT_RESTORE_REG(Port_Num , Amsel , PORT_ANALOG_MODE_SEL_REG_OFFSET , Mode_Mask , Image->Amsel);
+    PORT_RESTORE_REG(Port_Num , Afsel , PORT_ALT_FUNC_REG_OFFSET , Mode_Mask , Image->Afsel);
+    PORT_RESTORE_REG(Port_Num , Pctl , PORT_CTL_REG_OFFSET , Pctl_Mask , Image->Pctl);
+    PORT_RESTORE_REG(Port_Num , Dir , PORT_DIR_REG_OFFSET , Dir_Mask , Image->Dir);
+    PORT_RESTORE_REG(Port_Num , Den , PORT_DIGITAL_ENABLE_REG_OFFSET , Mode_Mask , Image->Den);
+  }
+}
+
 /************************************************************************************
 * Service Name: Port_Init
 * Sync/Async: Synchronous
@@ -37,6 +490,13 @@ STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 * Return value: None
 * Description: -Initialize ALL ports and port pins with the configuration set pointed to by the parameter ConfigPtr:
 *              -Initialize all configured resources
+*              -The clocks of the used ports are enabled together and polled once for readiness
+*              -With PORT_AHB_APERTURE the used ports are moved to the AHB aperture (GPIOHBCTL)
+*              -Every register of a used port is written once from the register images
+*               precomputed by tools/Port_Generator.py, no per pin decoding is done at runtime
+*              -With PORT_PIN_INTERRUPT_API the interrupt sense of the ports with armed pins is written
+*               once per register, then their GPIOIM and their NVIC vectors are enabled
+*              -With PORT_DEBOUNCE_API the current levels of the debounced pins become their debounced levels
 ************************************************************************************/
 
 void Port_Init( const Port_ConfigType* ConfigPtr )
@@ -50,6 +510,7 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
                                 PORT_INSTANCE_ID,
                                 Port_Init_SID,
                                 PORT_E_PARAM_CONFIG);
+                return;
 	}
 	else
         {
@@ -57,126 +518,201 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
         }
 #endif
         
+#if (PORT_STATISTICS_API == STD_ON)
+          PORT_TIMESTAMP_ENABLE();
+#endif
+          PORT_API_ENTER(Port_Init_SID);
+          
           Port_Status = PORT_INITIALIZED;
           Port_PinConfigPtr = ConfigPtr;
+          
+#if (PORT_MAIN_FUNCTION_API == STD_ON)
+          Port_MainPort = 0;
+          Port_MainRegister = 0;
+          for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+          {
+            Port_MainDrift[Port_Num] = 0;
+          }
+#endif
             
-          for(Port_PinType idx = PIN_MIN_NUMBER; idx < PORT_CONFIGURED_PINS; idx++)
+          /* Ports without configured pins stay gated */
+          Port_EnableClocks(Port_PinConfigPtr->Clock_Mask);
+          
+          /* Copy the precomputed register images of every used port */
+          for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
           {
-            volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-            volatile uint32 delay = 0;
+            const Port_PortImage * Image = &Port_PinConfigPtr->Port[Port_Num];
+            uint32 PortGpio_Base = Port_BaseAddress[Port_Num]; /* the required Port Registers base address */
+            
+            if(Image->Mask == 0)
+            {
+              /* Do Nothing ... No configured pins on this port */
+              continue;
+            }
             
-           switch(Port_PinConfigPtr->Pin[idx].Port_Num)
+           /* One unlock and one commit per port, whatever the number of its locked pins */
+           if(Image->Commit != 0)
            {
-               case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                        break;
-               case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                        break;
-               case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                        break;
-               case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                        break;
-               case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                        break;
-               case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                        break;
+              PORT_WRITE_REG(PortGpio_Base + PORT_LOCK_REG_OFFSET , PORT_LOCK_KEY);                                                          /* Unlock the GPIOCR register */   
+              PORT_WRITE_REG(PortGpio_Base + PORT_COMMIT_REG_OFFSET , PORT_READ_REG(PortGpio_Base + PORT_COMMIT_REG_OFFSET) | Image->Commit);   /* Set the bits of the locked pins in GPIOCR register to allow changes on them */
            }
            
-           /* Enable clock for PORT and allow time for clock to start*/
-		SYSCTL_REGCGC2_REG |= (1<<Port_PinConfigPtr->Pin[idx].Port_Num);
-		delay = SYSCTL_REGCGC2_REG;
-           
-           if( ((Port_PinConfigPtr->Pin[idx].Port_Num == 3) && (Port_PinConfigPtr->Pin[idx].Pin_Num == 7)) || ((Port_PinConfigPtr->Pin[idx].Port_Num == 5) && (Port_PinConfigPtr->Pin[idx].Pin_Num == 0)) ) /* PD7 or PF0 */
-           {
-              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;                     /* Unlock the GPIOCR register */   
-              SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , ConfigPtr->Pin[idx].Pin_Num);  /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-            }
-          else if( (Port_PinConfigPtr->Pin[idx].Port_Num == 2) && (Port_PinConfigPtr->Pin[idx].Pin_Num <= 3) ) /* PC0 to PC3 */
-          {
-              /* Do Nothing ...  this is the JTAG pins */
-              continue;
-          }
-          else
-          {
-              /* Do Nothing ... No need to unlock the commit register for this pin */
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+              Port_LoadShadow(Port_Num);    /* Only place where the shadowed registers are read */
+#endif
+              PORT_UPDATE_REG(Port_Num , Amsel , PORT_ANALOG_MODE_SEL_REG_OFFSET , Image->Mask , Image->Amsel);
+              PORT_UPDATE_REG(Port_Num , Afsel , PORT_ALT_FUNC_REG_OFFSET , Image->Mask , Image->Afsel);
+              PORT_UPDATE_REG(Port_Num , Pctl , PORT_CTL_REG_OFFSET , Image->Pctl_Mask , Image->Pctl);
+              PORT_UPDATE_REG(Port_Num , Pur , PORT_PULL_UP_REG_OFFSET , Image->Mask , Image->Pur);
+              PORT_UPDATE_REG(Port_Num , Pdr , PORT_PULL_DOWN_REG_OFFSET , Image->Mask , Image->Pdr);
+              PORT_WRITE_REG(Port_PinConfigPtr->Group[Port_Num].Data_Address , Image->Data);                /* Initial value before the pins are turned into outputs, masked store without read */
+              PORT_UPDATE_REG(Port_Num , Dir , PORT_DIR_REG_OFFSET , Image->Mask , Image->Dir);
+              PORT_UPDATE_REG(Port_Num , Den , PORT_DIGITAL_ENABLE_REG_OFFSET , Image->Mask , Image->Den);
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+              Port_WriteIrqImage(Port_Num , &Port_PinConfigPtr->Irq[Port_Num]);
+#endif
           }
           
-           
-           /*Configure the Mode of the Pin*/
-              switch(Port_PinConfigPtr->Pin[idx].Pin_Mode)
-              {
-              case PORT_PIN_MODE_ADC:
-                
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);     /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);             /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x0000000F << (Port_PinConfigPtr->Pin[idx].Pin_Num * 4));             /* Set the PMCx bits for this pin */
-              break;
-                
-                case PORT_PIN_MODE_ALT1:
-                case PORT_PIN_MODE_ALT2:
-                case PORT_PIN_MODE_ALT3:
-                case PORT_PIN_MODE_ALT4:
-                case PORT_PIN_MODE_ALT5:
-                case PORT_PIN_MODE_ALT6:
-                case PORT_PIN_MODE_ALT7:
-                case PORT_PIN_MODE_ALT8:
-                case PORT_PIN_MODE_ALT9:
-                  
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);               /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_PinConfigPtr->Pin[idx].Pin_Num * 4));     /* Clear the PMCx bits for this pin */
-                break;
-                
-                case PORT_PIN_MODE_GPIO:
-                  
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_PinConfigPtr->Pin[idx].Pin_Num * 4));     /* Clear the PMCx bits for this pin */
-                    
-                break;
-                
-                if(Port_PinConfigPtr->Pin[idx].Direction == PORT_PIN_OUT)
-                {
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);                /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-                   
-                  if(Port_PinConfigPtr->Pin[idx].Init_Value == STD_HIGH)
-                  {
-                      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);          /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-                  }
-                  else
-                  {
-                      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);        /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-                  }
-                 }
-                else if(Port_PinConfigPtr->Pin[idx].Direction == PORT_PIN_IN)
-                {
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);             /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-                     
-                    if(Port_PinConfigPtr->Pin[idx].Pull_Resistor == PORT_PIN_PUN)
-                    {
-                        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);       /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-                    }
-                    else if(Port_PinConfigPtr->Pin[idx].Pull_Resistor == PORT_PIN_PDN)
-                    {
-                       SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);     /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
-                    }
-                    else
-                    {
-                        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);     /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-                        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);   /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
-                    }
-                }
-                else
-                {
-                    /* Do Nothing */
-                }
-                
-              }
-          }
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+          Port_EnableInterrupts(Port_PinConfigPtr);
+#endif
+          
+#if (PORT_DEBOUNCE_API == STD_ON)
+          Port_ResetDebounce(Port_PinConfigPtr);
+#endif
+          
+#if (PORT_SNAPSHOT_API == STD_ON)
+          Port_SnapshotPrevious = Port_SnapshotCurrent;     /* No edge until the next snapshots */
+          Port_SnapshotTaken = FALSE;
+#endif
+          
+          PORT_API_EXIT(Port_Init_SID);
+}
+
+
+/************************************************************************************
+* Service Name: Port_EarlyInit
+* Sync/Async: Synchronous
+* Reentrancy: Non-Reentrant
+* Parameters (in): ConfigPtr - Pointer to configuration set.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: -First initialization phase, called from __iar_program_start in cstartup_M.c right after
+*               reset and before the C runtime initialization: only the PORT_PIN_CRITICAL pins of the
+*               set are configured, their bits taken from the register images of their port with the
+*               generated per port Critical pin mask
+*              -No RAM variable is used (neither initialized nor zeroed yet), so no shadow, no statistics
+*               and no development error report, a NULL_PTR configuration is ignored
+*              -Only the registers where the critical pins differ from their reset value are written
+*              -Port_Init remains mandatory, it configures every pin again (same values for the critical
+*               pins, so no glitch) and initializes the driver state
+************************************************************************************/
 
+#if (PORT_EARLY_INIT_API == STD_ON)
+void Port_EarlyInit( const Port_ConfigType* ConfigPtr )
+{
+  uint32 Clock_Mask = 0;
+  
+  if(NULL_PTR == ConfigPtr)
+  {
+    /* Do Nothing ... Everything is left to Port_Init */
+    return;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  
+  /* Ports with critical pins */
+  for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+  {
+    if(ConfigPtr->Critical[Port_Num] != 0)
+    {
+      Clock_Mask |= (uint32)1 << Port_Num;
+    }
+  }
+  
+  if(Clock_Mask == 0)
+  {
+    /* Do Nothing ... No critical pins, everything is left to Port_Init */
+    return;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  
+  PORT_SIM_API_ENTER(Port_EarlyInit_SID);
+  
+  Port_EnableClocks(Clock_Mask);
+  
+  for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+  {
+    const Port_PortImage * Image = &ConfigPtr->Port[Port_Num];
+    uint32 PortGpio_Base = Port_BaseAddress[Port_Num];
+    uint32 Mask = ConfigPtr->Critical[Port_Num];   /* critical pins of the port, their bits are taken from its image */
+    uint32 Pctl_Mask = 0;
+    
+    if(Mask == 0)
+    {
+      /* Do Nothing ... No critical pins on this port */
+      continue;
+    }
+    
+    /* PMCx fields of the critical pins */
+    for(uint8 Pin_Num = 0; Pin_Num < PORT_PINS_PER_PORT; Pin_Num++)
+    {
+      if((Mask & ((uint32)1 << Pin_Num)) != 0)
+      {
+        Pctl_Mask |= (uint32)0x0000000F << (Pin_Num * 4U);
+      }
+    }
+    
+    if((Image->Commit & Mask) != 0)
+    {
+      PORT_WRITE_REG(PortGpio_Base + PORT_LOCK_REG_OFFSET , PORT_LOCK_KEY);
+      PORT_SET_REG_BITS(PortGpio_Base + PORT_COMMIT_REG_OFFSET , Image->Commit & Mask);
+    }
+    
+    /* The registers are at their reset value (0 for the pins that are not JTAG ones), only the set bits need a write */
+    if((Image->Amsel & Mask) != 0)
+    {
+      PORT_WRITE_REG_MASKED(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET , Mask , Image->Amsel);
+    }
+    if((Image->Afsel & Mask) != 0)
+    {
+      PORT_WRITE_REG_MASKED(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET , Mask , Image->Afsel);
+    }
+    if((Image->Pctl & Pctl_Mask) != 0)
+    {
+      PORT_WRITE_REG_MASKED(PortGpio_Base + PORT_CTL_REG_OFFSET , Pctl_Mask , Image->Pctl);
+    }
+    if((Image->Pur & Mask) != 0)
+    {
+      PORT_WRITE_REG_MASKED(PortGpio_Base + PORT_PULL_UP_REG_OFFSET , Mask , Image->Pur);
+    }
+    if((Image->Pdr & Mask) != 0)
+    {
+      PORT_WRITE_REG_MASKED(PortGpio_Base + PORT_PULL_DOWN_REG_OFFSET , Mask , Image->Pdr);
+    }
+    if((Image->Data & Mask) != 0)
+    {
+      PORT_WRITE_REG(PORT_DATA_MASKED_ADDRESS(PortGpio_Base , Mask) , Image->Data);
+    }
+    if((Image->Dir & Mask) != 0)
+    {
+      PORT_WRITE_REG_MASKED(PortGpio_Base + PORT_DIR_REG_OFFSET , Mask , Image->Dir);
+    }
+    if((Image->Den & Mask) != 0)
+    {
+      PORT_WRITE_REG_MASKED(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET , Mask , Image->Den);
+    }
+  }
+  
+  PORT_SIM_API_EXIT(Port_EarlyInit_SID);
 }
+#endif
 
 
 /************************************************************************************
@@ -189,9 +725,11 @@ void Port_Init( const Port_ConfigType* ConfigPtr )
 * Parameters (out): None
 * Return value: None
 * Description: -Sets the port pin direction
+*              -With PORT_BIT_BAND_ACCESS the GPIODIR bit is written through its bit-band alias, a single
+*               store that cannot lose a change of another pin of the port done from an interrupt
 ************************************************************************************/
 
-#if (Port_Set_Pin_Direction_Api == STD_ON)
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
 void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
 {
   #if (PORT_DEV_ERROR_DETECT == STD_ON)
@@ -202,6 +740,7 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
                             PORT_INSTANCE_ID,
                             Port_SetPinDirection_SID,
                             PORT_E_UNINIT);
+            return;
 	}
         
 	else
@@ -216,6 +755,7 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
                             PORT_INSTANCE_ID,
                             Port_SetPinDirection_SID,
                             PORT_E_PARAM_INVALID_PIN_ID);
+            return;
         }
         
         else
@@ -223,8 +763,8 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
           /* Do Nothing */
         }
         
-        /* check if the Pin Direction is Unchangeable or not */
-        if(Port_PinConfigPtr->Pin[Pin].Pin_Change_Direction == No_Change)
+        /* check if the Pin Direction is Unchangeable or not, the pins the configuration leaves untouched (protected JTAG pins) included */
+        if((PORT_PIN_CFG_CHANGE_DIRECTION(Port_PinConfigPtr->Pin[Pin]) == No_Change) || !PORT_PIN_OWNED(Pin))
         {
           Det_ReportError(PORT_MODULE_ID,
                           PORT_INSTANCE_ID,
@@ -240,41 +780,44 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
 
 #endif
         
-          volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-       
-
-         
-          switch(Port_PinConfigPtr->Pin[Pin].Port_Num)
-          {
-               case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                        break;
-               case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                        break;
-               case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                        break;
-               case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                        break;
-               case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                        break;
-               case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                        break;
-          }
-
-          if(Direction == PORT_PIN_OUT)
-          {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);                /* Set the corresponding bit in the GPIODIR register to configure it as output pin */                 
-          }
-                           
-          else if(Direction == PORT_PIN_IN)
+          PORT_API_ENTER(Port_SetPinDirection_SID);
+          
+          /* A pin the configuration does not own (protected JTAG pins) stays untouched, with or without DET */
+          if(PORT_PIN_OWNED(Pin))
           {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);             /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
+#if (PORT_BIT_BAND_ACCESS == STD_ON) && ((PORT_SHADOW_REGISTERS == STD_OFF) || (PORT_LOCK_FREE_UPDATES == STD_ON))
+            
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+            uint32 Mask = Port_PinConfigPtr->Pin_Desc[Pin].Mask;   /* precomputed bit of the pin in its port registers */
+            uint8 Port_Num = PORT_PIN_CFG_PORT_NUM(Port_PinConfigPtr->Pin[Pin]);
+            
+            PORT_UPDATE_BEGIN(Port_Num);
+            PORT_ATOMIC_WRITE_WORD_MASKED(&Port_Shadow[Port_Num].Dir , Mask , (Direction == PORT_PIN_OUT) ? Mask : 0U);
+#endif
+            
+            /* One store to the bit-band alias of the pin GPIODIR bit, no read of the register, the bus
+             * performs the read-modify-write of GPIODIR so an interrupt cannot split it */
+            PORT_WRITE_REG(PORT_PIN_DIR_ALIAS(Pin) , (Direction == PORT_PIN_OUT) ? 1U : 0U);
+            
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+            PORT_UPDATE_END(Port_Num);
+#endif
+            
+#else
+            
+            uint32 Mask = Port_PinConfigPtr->Pin_Desc[Pin].Mask;   /* precomputed bit of the pin in its port registers */
+            
+            /* Set the corresponding bit in the GPIODIR register for an output pin, clear it for an input pin */
+            PORT_ATOMIC_UPDATE_REG(PORT_PIN_CFG_PORT_NUM(Port_PinConfigPtr->Pin[Pin]) , Dir , PORT_DIR_REG_OFFSET , Mask , (Direction == PORT_PIN_OUT) ? Mask : 0U);
+            
+#endif
           }
-          
           else
           {
             /* Do Nothing */
-          }    
-        }
+          }
+          
+          PORT_API_EXIT(Port_SetPinDirection_SID);
 }
 #endif
 
@@ -288,6 +831,9 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
 * Parameters (out): None
 * Return value: None
 * Description: -Refreshes port direction.
+*              -The cost is one GPIODIR update per port, independent of the number of pins
+*              -GPIODIR is updated with an exclusive load/store retry loop, a direction change done from an
+*               interrupt is not lost
 ************************************************************************************/
 
 void Port_RefreshPortDirection( void )
@@ -300,6 +846,7 @@ void Port_RefreshPortDirection( void )
                         PORT_INSTANCE_ID,
                         Port_RefreshPortDirection_SID,
                         PORT_E_UNINIT);
+        return;
       }
       else
       {
@@ -308,88 +855,263 @@ void Port_RefreshPortDirection( void )
         
 #endif
       
-        for(Port_PinType idx = PIN_MIN_NUMBER; idx < PORT_CONFIGURED_PINS; idx++)
+        PORT_API_ENTER(Port_RefreshPortDirection_SID);
+        
+        /* One masked update of GPIODIR per port, restoring only the pins with an unchangeable direction */
+        for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+        {
+          const Port_PortImage * Image = &Port_PinConfigPtr->Port[Port_Num];
+          
+          if(Image->Dir_Locked != 0)
           {
-            volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-            
-           switch(Port_PinConfigPtr->Pin[idx].Port_Num)
-           {
-               case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                        break;
-               case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                        break;
-               case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                        break;
-               case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                        break;
-               case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                        break;
-               case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                        break;
-           }
-           
-             if(Port_PinConfigPtr->Pin[idx].Pin_Change_Direction == Change)
-             {
-               /*Do Nothing*/
-             }
-             else
-             {
-                if(Port_PinConfigPtr->Pin[idx].Direction == PORT_PIN_OUT)
-                {
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);                /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-                }
-                else if(Port_PinConfigPtr->Pin[idx].Direction == PORT_PIN_IN)
-                {
-                   CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_PinConfigPtr->Pin[idx].Pin_Num);             /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */    
-                }
-             }
-           
+            PORT_ATOMIC_UPDATE_REG(Port_Num , Dir , PORT_DIR_REG_OFFSET , Image->Dir_Locked , Image->Dir);
           }
-      
+          else
+          {
+            /* Do Nothing ... All pins of this port can change their direction */
+          }
+        }
         
+        PORT_API_EXIT(Port_RefreshPortDirection_SID);
 }
 
 /************************************************************************************
-* Service Name: Port_GetVersionInfo    
+* Service Name: Port_MainFunction
 * Sync/Async: Synchronous
 * Reentrancy: Non Reentrant
 * Parameters (in): None
 * Parameters (inout): None
-* Parameters (out): Version info -Pointer to where to store the version information of this module.
+* Parameters (out): None
 * Return value: None
-* Description: -Refreshes port direction.
+* Description: -Cyclic background check of the port registers, PORT_MAIN_FUNCTION_REGISTERS registers
+*               per call round-robin over the used ports, so the cost of one call is bounded whatever
+*               the configuration: at most one read and one write per register
+*              -With PORT_SHADOW_REGISTERS each shadowed register is compared with its shadow (GPIODIR
+*               with the unchangeable directions forced to the configured ones), otherwise the GPIODIR
+*               bits of the pins with an unchangeable direction are compared with the configuration
+*              -A differing register is written back, reported with PORT_E_REGISTER_DRIFT and recorded
+*               for Port_GetMainFunctionDrift
+*              -Each register is compared and repaired with the interrupts disabled, with plain accesses.
+*               A port with a reentrant pin API update in progress (Port_MainFunction preempted it between
+*               its shadow and register stores) is left to the next call
+*              -Silently does nothing before Port_Init
 ************************************************************************************/
 
-#if (PORT_VERSION_INFO_API == STD_ON)
-void Port_GetVersionInfo( Std_VersionInfoType* versioninfo )
+#if (PORT_MAIN_FUNCTION_API == STD_ON)
+void Port_MainFunction( void )
 {
-      #if (PORT_DEV_ERROR_DETECT == STD_ON)
-	/* check if the input configuration pointer is not a NULL_PTR */
-	if (NULL_PTR == versioninfo)
-	{
-		Det_ReportError(PORT_MODULE_ID,
-                                PORT_INSTANCE_ID,
-                                Port_GetVersionInfo_SID,
-                                PORT_E_PARAM_POINTER);
-	}
-	else
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      PORT_API_ENTER(Port_MainFunction_SID);
+      
+      for(uint8 Count = 0; Count < PORT_MAIN_FUNCTION_REGISTERS; Count++)
+      {
+        const Port_PortImage * Image;
+        uint32 Address;
+        uint32 Expected = 0;
+        uint32 Actual = 0;
+        boolean Busy = FALSE;
+        uint8 Skipped = 0;
+        
+        /* Skip the unused ports, they are neither clocked nor shadowed */
+        while((Port_PinConfigPtr->Port[Port_MainPort].Mask == 0) && (Skipped < PORT_NUMBER_OF_PORTS))
         {
-          /* Do Nothing */
+          Port_MainPort = (Port_MainPort + 1U) % PORT_NUMBER_OF_PORTS;
+          Port_MainRegister = 0;
+          Skipped++;
+        }
+        if(Skipped == PORT_NUMBER_OF_PORTS)
+        {
+          /* Do Nothing ... No used port */
+          break;
         }
+        
+        Image = &Port_PinConfigPtr->Port[Port_MainPort];
+        
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+        uint32 * Shadow = Port_ShadowOf(Port_MainPort, Port_MainRegisterOffset[Port_MainRegister]);
+        
+        Address = Port_BaseAddress[Port_MainPort] + Port_MainRegisterOffset[Port_MainRegister];
+#else
+        Address = Port_BaseAddress[Port_MainPort] + PORT_DIR_REG_OFFSET;
 #endif
         
-  	/* Copy the vendor Id */
-	versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
-	/* Copy the module Id */
-	versioninfo->moduleID = (uint16)PORT_MODULE_ID;
-	/* Copy Software Major Version */
-	versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
-	/* Copy Software Minor Version */
-	versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
-	/* Copy Software Patch Version */
-	versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+        PORT_ENTER_CRITICAL();
+        
+        if(Port_UpdatesInProgress[Port_MainPort] != 0U)
+        {
+          /* Do Nothing ... The preempted update completes once this call returns */
+          Busy = TRUE;
         }
-	
+        else
+        {
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+          if(Port_MainRegisterOffset[Port_MainRegister] == PORT_DIR_REG_OFFSET)
+          {
+            /* Refresh of the unchangeable directions */
+            *Shadow = (*Shadow & ~Image->Dir_Locked) | (Image->Dir & Image->Dir_Locked);
+          }
+          Expected = *Shadow;
+          Actual = PORT_READ_REG(Address);
+#else
+          Actual = PORT_READ_REG(Address);
+          Expected = (Actual & ~Image->Dir_Locked) | (Image->Dir & Image->Dir_Locked);
+#endif
+          if(Actual != Expected)
+          {
+            PORT_WRITE_REG(Address , Expected);
+            Port_MainDrift[Port_MainPort] |= (uint8)(1U << Port_MainRegister);
+          }
+        }
+        
+        PORT_EXIT_CRITICAL();
+        
+        if(Busy)
+        {
+          /* Do Nothing ... Same register again on the next call */
+          break;
+        }
+        
+        if(Actual != Expected)
+        {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+          Det_ReportError(PORT_MODULE_ID,
+                          PORT_INSTANCE_ID,
+                          Port_MainFunction_SID,
+                          PORT_E_REGISTER_DRIFT);
+#endif
+        }
+        else
+        {
+          /* Do Nothing */
+        }
+        
+        if(++Port_MainRegister == PORT_MAIN_REGISTERS_PER_PORT)
+        {
+          Port_MainRegister = 0;
+          Port_MainPort = (Port_MainPort + 1U) % PORT_NUMBER_OF_PORTS;
+        }
+      }
+      
+      PORT_API_EXIT(Port_MainFunction_SID);
+}
+#endif
+
+/************************************************************************************
+* Service Name: Port_GetMainFunctionDrift
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Drift -Array of PORT_NUMBER_OF_PORTS entries, each one receives the
+*                          PORT_SHADOW_DRIFT_xxx bits of the registers of that port repaired by
+*                          Port_MainFunction since the previous call (only PORT_SHADOW_DRIFT_DIR
+*                          without PORT_SHADOW_REGISTERS)
+* Return value: Std_ReturnType -E_OK if no register was repaired, E_NOT_OK otherwise
+* Description: -Drift status of the background check, with or without development error detection
+*              -The recorded bits are cleared, with the interrupts disabled so a repair done by a
+*               preempting Port_MainFunction is not lost
+************************************************************************************/
+
+#if (PORT_MAIN_FUNCTION_API == STD_ON)
+Std_ReturnType Port_GetMainFunctionDrift( uint8* Drift )
+{
+  Std_ReturnType Result = E_OK;
+  
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_GetMainFunctionDrift_SID,
+                        PORT_E_UNINIT);
+        return E_NOT_OK;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      if (NULL_PTR == Drift)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_GetMainFunctionDrift_SID,
+                        PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      PORT_API_ENTER(Port_GetMainFunctionDrift_SID);
+      
+      PORT_ENTER_CRITICAL();
+      
+      for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+      {
+        Drift[Port_Num] = Port_MainDrift[Port_Num];
+        Port_MainDrift[Port_Num] = 0;
+        Result = (Drift[Port_Num] != 0) ? E_NOT_OK : Result;
+      }
+      
+      PORT_EXIT_CRITICAL();
+      
+      PORT_API_EXIT(Port_GetMainFunctionDrift_SID);
+      
+      return Result;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Port_GetVersionInfo    
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Version info -Pointer to where to store the version information of this module.
+* Return value: None
+* Description: -Returns the version information of this module.
+************************************************************************************/
+
+#if (PORT_VERSION_INFO_API == STD_ON)
+void Port_GetVersionInfo( Std_VersionInfoType* versioninfo )
+{
+      #if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == versioninfo)
+	{
+		Det_ReportError(PORT_MODULE_ID,
+                                PORT_INSTANCE_ID,
+                                Port_GetVersionInfo_SID,
+                                PORT_E_PARAM_POINTER);
+                return;
+	}
+	else
+        {
+          /* Do Nothing */
+        }
+#endif
+        
+  	/* Copy the vendor Id */
+	versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
+	/* Copy the module Id */
+	versioninfo->moduleID = (uint16)PORT_MODULE_ID;
+	/* Copy Software Major Version */
+	versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
+	/* Copy Software Minor Version */
+	versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
+	/* Copy Software Patch Version */
+	versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
 }
 #endif
 
@@ -403,6 +1125,9 @@ void Port_GetVersionInfo( Std_VersionInfoType* versioninfo )
 * Parameters (out): Version info -Pointer to where to store the version information of this module.
 * Return value: None
 * Description: -Sets the port pin mode..
+*              -The mode is checked and encoded into its PMCx value with one lookup in the
+*               pin multiplexing database of Port_PinMux.c
+*              -Each mode register (and its shadow) is updated with an exclusive load/store retry loop
 ************************************************************************************/
 
 void Port_SetPinMode( Port_PinType Pin, Port_PinModeType Mode )
@@ -415,6 +1140,7 @@ void Port_SetPinMode( Port_PinType Pin, Port_PinModeType Mode )
                         PORT_INSTANCE_ID,
                         Port_SetPinMode_SID,
                         PORT_E_UNINIT);
+        return;
       }
       
       else
@@ -424,12 +1150,13 @@ void Port_SetPinMode( Port_PinType Pin, Port_PinModeType Mode )
       
       
         /* check if the Pin Number is invalid */
-      if (Pin < PIN_MIN_NUMBER || Pin > PORT_CONFIGURED_PINS)
+      if (Pin < PIN_MIN_NUMBER || Pin >= PORT_CONFIGURED_PINS)
       {
         Det_ReportError(PORT_MODULE_ID,
                         PORT_INSTANCE_ID,
                         Port_SetPinMode_SID,
                         PORT_E_PARAM_PIN);
+        return;
       }
       
       else 
@@ -437,8 +1164,8 @@ void Port_SetPinMode( Port_PinType Pin, Port_PinModeType Mode )
         /* Do Nothing */
       }
       
-              /* check if the Pin Mode is Unchangeable or not */
-        if(Port_PinConfigPtr->Pin[Pin].Pin_Change_Mode == No_Change)
+              /* check if the Pin Mode is Unchangeable or not, the pins the configuration leaves untouched (protected JTAG pins) included */
+        if((PORT_PIN_CFG_CHANGE_MODE(Port_PinConfigPtr->Pin[Pin]) == No_Change) || !PORT_PIN_OWNED(Pin))
         {
           Det_ReportError(PORT_MODULE_ID,
                           PORT_INSTANCE_ID,
@@ -451,65 +1178,1352 @@ void Port_SetPinMode( Port_PinType Pin, Port_PinModeType Mode )
         {
           /* Do Nothing */
         }
+        
+        /* check if the pin supports the Mode, one lookup in the pin multiplexing database */
+        if((Port_PinMuxEntry(Port_PinConfigPtr->Pin[Pin], Mode) & PORT_PINMUX_VALID) == 0)
+        {
+          Det_ReportError(PORT_MODULE_ID,
+                          PORT_INSTANCE_ID,
+                          Port_SetPinMode_SID,
+                          PORT_E_MODE_NOT_SUPPORTED);
+          return;
+        }
+        
+        else
+        {
+          /* Do Nothing */
+        }
       
 #endif
       
-         volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+         const Port_PinDescType * Pin_Desc = &Port_PinConfigPtr->Pin_Desc[Pin]; /* precomputed mask and PMCx shift of the pin */
+         
+            PORT_API_ENTER(Port_SetPinMode_SID);
             
-           switch(Port_PinConfigPtr->Pin[Pin].Port_Num)
-           {
-               case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                        break;
-               case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                        break;
-               case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                        break;
-               case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                        break;
-               case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                        break;
-               case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                        break;
-           }
-            switch(Mode)
+            /* A pin the configuration does not own (protected JTAG pins) stays untouched, with or without DET */
+            if(PORT_PIN_OWNED(Pin))
             {
-              case PORT_PIN_MODE_ADC:
-                
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);             /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x0000000F << (Port_PinConfigPtr->Pin[Pin].Pin_Num * 4));             /* Set the PMCx bits for this pin */
-              break;
-                
-              case PORT_PIN_MODE_ALT1:
-              case PORT_PIN_MODE_ALT2:
-              case PORT_PIN_MODE_ALT3:
-              case PORT_PIN_MODE_ALT4:
-              case PORT_PIN_MODE_ALT5:
-              case PORT_PIN_MODE_ALT6:
-              case PORT_PIN_MODE_ALT7:
-              case PORT_PIN_MODE_ALT8:
-              case PORT_PIN_MODE_ALT9:
-                  
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);               /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_PinConfigPtr->Pin[Pin].Pin_Num * 4));     /* Clear the PMCx bits for this pin */
-              break;
-                
-              case PORT_PIN_MODE_GPIO:
-                  
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_PinConfigPtr->Pin[Pin].Pin_Num);             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_PinConfigPtr->Pin[Pin].Pin_Num * 4));     /* Clear the PMCx bits for this pin */
-              break;
+              Port_WritePinsMode(PORT_PIN_CFG_PORT_NUM(Port_PinConfigPtr->Pin[Pin]) , Pin_Desc->Mask , (uint32)0x0000000F << Pin_Desc->Pctl_Shift ,
+                                 (uint32)(Port_PinMuxEntry(Port_PinConfigPtr->Pin[Pin], Mode) & PORT_PINMUX_PCTL_MASK) << Pin_Desc->Pctl_Shift , Mode);
             }
-           
-      
+            else
+            {
+              /* Do Nothing */
+            }
+            
+            PORT_API_EXIT(Port_SetPinMode_SID);
 }
 
 
+/************************************************************************************
+* Service Name: Port_SetPinDirections
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Pins      -List of Port Pin ID numbers
+                   Count     -Number of pins in the list
+                   Direction -Port Pin Direction applied to all of them
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: -Sets the direction of a group of pins, e.g. a parallel bus
+*              -All pins are checked before any register is written, one rejected pin leaves
+*               every pin unchanged
+*              -One GPIODIR update per affected port, independent of the number of pins, with an exclusive
+*               load/store retry loop
+************************************************************************************/
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+void Port_SetPinDirections( const Port_PinType* Pins, uint8 Count, Port_PinDirectionType Direction )
+{
+  uint32 Port_Mask[PORT_NUMBER_OF_PORTS] = {0};   /* pins of the list in every port */
+  
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_SetPinDirections_SID,
+                        PORT_E_UNINIT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      if (NULL_PTR == Pins)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_SetPinDirections_SID,
+                        PORT_E_PARAM_POINTER);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      for(uint8 idx = 0; idx < Count; idx++)
+      {
+        /* check if the the Pin is Valid */
+        if(Pins[idx] >= PORT_CONFIGURED_PINS)
+        {
+          Det_ReportError(PORT_MODULE_ID,
+                          PORT_INSTANCE_ID,
+                          Port_SetPinDirections_SID,
+                          PORT_E_PARAM_INVALID_PIN_ID);
+          return;
+        }
+        /* check if the Pin Direction is Unchangeable or not, the pins the configuration leaves untouched (protected JTAG pins) included */
+        else if((PORT_PIN_CFG_CHANGE_DIRECTION(Port_PinConfigPtr->Pin[Pins[idx]]) == No_Change) || !PORT_PIN_OWNED(Pins[idx]))
+        {
+          Det_ReportError(PORT_MODULE_ID,
+                          PORT_INSTANCE_ID,
+                          Port_SetPinDirections_SID,
+                          PORT_E_DIRECTION_UNCHANGEABLE);
+          return;
+        }
+        else
+        {
+          /* Do Nothing */
+        }
+      }
+#endif
+      
+      PORT_API_ENTER(Port_SetPinDirections_SID);
+      
+      for(uint8 idx = 0; idx < Count; idx++)
+      {
+        uint8 Port_Num = PORT_PIN_CFG_PORT_NUM(Port_PinConfigPtr->Pin[Pins[idx]]);
+        
+        /* Only the pins the configuration owns, the protected JTAG pins stay untouched with or without DET */
+        Port_Mask[Port_Num] |= Port_PinConfigPtr->Pin_Desc[Pins[idx]].Mask & Port_PinConfigPtr->Port[Port_Num].Mask;
+      }
+      
+      for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+      {
+        if(Port_Mask[Port_Num] != 0)
+        {
+          PORT_ATOMIC_UPDATE_REG(Port_Num , Dir , PORT_DIR_REG_OFFSET , Port_Mask[Port_Num] , (Direction == PORT_PIN_OUT) ? Port_Mask[Port_Num] : 0U);
+        }
+        else
+        {
+          /* Do Nothing ... No pin of the list on this port */
+        }
+      }
+      
+      PORT_API_EXIT(Port_SetPinDirections_SID);
+}
+#endif
 
 
+/************************************************************************************
+* Service Name: Port_SetPinModes
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Pins  -List of Port Pin ID numbers
+                   Count -Number of pins in the list
+                   Mode  -Port Pin mode applied to all of them
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: -Sets the mode of a group of pins
+*              -All pins are checked before any register is written, one rejected pin leaves
+*               every pin unchanged
+*              -One update of each mode register per affected port, independent of the number of pins, with
+*               an exclusive load/store retry loop
+************************************************************************************/
 
+void Port_SetPinModes( const Port_PinType* Pins, uint8 Count, Port_PinModeType Mode )
+{
+  uint32 Port_Mask[PORT_NUMBER_OF_PORTS] = {0};   /* pins of the list in every port */
+  uint32 Pctl_Mask[PORT_NUMBER_OF_PORTS] = {0};   /* PMCx fields of the same pins */
+  uint32 Pctl[PORT_NUMBER_OF_PORTS] = {0};        /* PMCx values of Mode on the same pins */
+  
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_SetPinModes_SID,
+                        PORT_E_UNINIT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      if (NULL_PTR == Pins)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_SetPinModes_SID,
+                        PORT_E_PARAM_POINTER);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      for(uint8 idx = 0; idx < Count; idx++)
+      {
+        /* check if the Pin Number is invalid */
+        if(Pins[idx] >= PORT_CONFIGURED_PINS)
+        {
+          Det_ReportError(PORT_MODULE_ID,
+                          PORT_INSTANCE_ID,
+                          Port_SetPinModes_SID,
+                          PORT_E_PARAM_PIN);
+          return;
+        }
+        /* check if the Pin Mode is Unchangeable or not, the pins the configuration leaves untouched (protected JTAG pins) included */
+        else if((PORT_PIN_CFG_CHANGE_MODE(Port_PinConfigPtr->Pin[Pins[idx]]) == No_Change) || !PORT_PIN_OWNED(Pins[idx]))
+        {
+          Det_ReportError(PORT_MODULE_ID,
+                          PORT_INSTANCE_ID,
+                          Port_SetPinModes_SID,
+                          PORT_E_PARAM_INVALID_MODE);
+          return;
+        }
+        /* check if the pin supports the Mode */
+        else if((Port_PinMuxEntry(Port_PinConfigPtr->Pin[Pins[idx]], Mode) & PORT_PINMUX_VALID) == 0)
+        {
+          Det_ReportError(PORT_MODULE_ID,
+                          PORT_INSTANCE_ID,
+                          Port_SetPinModes_SID,
+                          PORT_E_MODE_NOT_SUPPORTED);
+          return;
+        }
+        else
+        {
+          /* Do Nothing */
+        }
+      }
+#endif
+      
+      PORT_API_ENTER(Port_SetPinModes_SID);
+      
+      for(uint8 idx = 0; idx < Count; idx++)
+      {
+        const Port_PinDescType * Pin_Desc = &Port_PinConfigPtr->Pin_Desc[Pins[idx]];
+        uint8 Port_Num = PORT_PIN_CFG_PORT_NUM(Port_PinConfigPtr->Pin[Pins[idx]]);
+        
+        /* The pins the configuration does not own (protected JTAG pins) stay untouched, with or without DET */
+        if(PORT_PIN_OWNED(Pins[idx]))
+        {
+          Port_Mask[Port_Num] |= Pin_Desc->Mask;
+          Pctl_Mask[Port_Num] |= (uint32)0x0000000F << Pin_Desc->Pctl_Shift;
+          Pctl[Port_Num] |= (uint32)(Port_PinMuxEntry(Port_PinConfigPtr->Pin[Pins[idx]], Mode) & PORT_PINMUX_PCTL_MASK) << Pin_Desc->Pctl_Shift;
+        }
+        else
+        {
+          /* Do Nothing */
+        }
+      }
+      
+      for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+      {
+        if(Port_Mask[Port_Num] != 0)
+        {
+          Port_WritePinsMode(Port_Num , Port_Mask[Port_Num] , Pctl_Mask[Port_Num] , Pctl[Port_Num] , Mode);
+        }
+        else
+        {
+          /* Do Nothing ... No pin of the list on this port */
+        }
+      }
+      
+      PORT_API_EXIT(Port_SetPinModes_SID);
+}
+
+
+/************************************************************************************
+* Service Name: Port_WritePinLevel
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Pin   -Port Pin ID number
+                   Level -STD_HIGH or STD_LOW
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: -Drives the level of one pin with a single store to the GPIODATA address
+*               masked to that pin, the other pins of the port are not affected
+*              -The pin must be owned by the configuration and currently an output
+************************************************************************************/
+
+#if (PORT_WRITE_LEVEL_API == STD_ON)
+void Port_WritePinLevel( Port_PinType Pin, uint8 Level )
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_WritePinLevel_SID,
+                        PORT_E_UNINIT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      /* check if the Pin Number is invalid */
+      if (Pin >= PORT_CONFIGURED_PINS)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_WritePinLevel_SID,
+                        PORT_E_PARAM_PIN);
+        return;
+      }
+      /* check if the Pin is left untouched by the configuration (protected JTAG pins) */
+      else if (!PORT_PIN_OWNED(Pin))
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_WritePinLevel_SID,
+                        PORT_E_PARAM_PIN);
+        return;
+      }
+      /* check if the Pin is an output */
+      else if (!PORT_PIN_IS_OUTPUT(Pin))
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_WritePinLevel_SID,
+                        PORT_E_PIN_NOT_OUTPUT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      /* check if the Level is valid */
+      if ((Level != STD_HIGH) && (Level != STD_LOW))
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_WritePinLevel_SID,
+                        PORT_E_PARAM_INVALID_LEVEL);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      PORT_API_ENTER(Port_WritePinLevel_SID);
+      
+      /* A pin the configuration does not own (protected JTAG pins) stays untouched, with or without DET */
+      if(PORT_PIN_OWNED(Pin))
+      {
+        PORT_WRITE_REG(PORT_PIN_DATA_ADDRESS(Pin) , (Level == STD_HIGH) ? 0xFFU : 0x00U);
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      PORT_API_EXIT(Port_WritePinLevel_SID);
+}
+
+/************************************************************************************
+* Service Name: Port_WritePortLevel
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Port_Num -Port number (PORT_PORTA ... PORT_PORTF)
+                   Mask     -Pins of the port to be driven
+                   Level    -New levels of the masked pins
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: -Drives any subset of the configured pins of a port with a single store to the
+*               GPIODATA address masked to that subset, pins outside the configuration are
+*               never touched
+*              -Like Port_WritePinLevel only the pins currently driven as outputs are written,
+*               the input pins of Mask are left out of the store
+************************************************************************************/
+
+void Port_WritePortLevel( uint8 Port_Num, uint8 Mask, uint8 Level )
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_WritePortLevel_SID,
+                        PORT_E_UNINIT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      /* check if the Port Number is invalid */
+      if (Port_Num >= PORT_NUMBER_OF_PORTS)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_WritePortLevel_SID,
+                        PORT_E_PARAM_INVALID_PORT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      /* The group address of the port with its pin select bits replaced by the requested subset */
+      uint32 Data_Address = Port_PinConfigPtr->Group[Port_Num].Data_Address & ~(uint32)PORT_DATA_REG_OFFSET;
+      
+      PORT_API_ENTER(Port_WritePortLevel_SID);
+      PORT_WRITE_REG(PORT_DATA_MASKED_ADDRESS(Data_Address , Mask & Port_PinConfigPtr->Port[Port_Num].Mask & PORT_PORT_OUTPUTS(Port_Num)) , Level);
+      PORT_API_EXIT(Port_WritePortLevel_SID);
+}
+#endif
+
+
+/************************************************************************************
+* Service Name: Port_CheckShadow
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Drift -Array of PORT_NUMBER_OF_PORTS entries, each one receives the
+*                          PORT_SHADOW_DRIFT_xxx bits of the registers of that port whose
+*                          content differs from their shadow (0 for unused ports)
+* Return value: Std_ReturnType -E_OK if all shadowed registers match, E_NOT_OK otherwise
+* Description: -Periodic consistency check of the shadowed registers, the only runtime service
+*               reading them. The shadow is not repaired, a later update of a drifting register
+*               writes the shadow content back to it
+************************************************************************************/
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+Std_ReturnType Port_CheckShadow( uint8* Drift )
+{
+  Std_ReturnType Result = E_OK;
+  
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_CheckShadow_SID,
+                        PORT_E_UNINIT);
+        return E_NOT_OK;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      if (NULL_PTR == Drift)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_CheckShadow_SID,
+                        PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      PORT_API_ENTER(Port_CheckShadow_SID);
+      
+      for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+      {
+        uint32 PortGpio_Base = Port_BaseAddress[Port_Num];
+        const Port_ShadowType * Shadow = &Port_Shadow[Port_Num];
+        uint8 Port_Drift = 0;
+        
+        if(Port_PinConfigPtr->Port[Port_Num].Mask != 0)
+        {
+          Port_Drift |= (PORT_READ_REG(PortGpio_Base + PORT_DIR_REG_OFFSET) != Shadow->Dir) ? PORT_SHADOW_DRIFT_DIR : 0U;
+          Port_Drift |= (PORT_READ_REG(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET) != Shadow->Den) ? PORT_SHADOW_DRIFT_DEN : 0U;
+          Port_Drift |= (PORT_READ_REG(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET) != Shadow->Afsel) ? PORT_SHADOW_DRIFT_AFSEL : 0U;
+          Port_Drift |= (PORT_READ_REG(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET) != Shadow->Amsel) ? PORT_SHADOW_DRIFT_AMSEL : 0U;
+          Port_Drift |= (PORT_READ_REG(PortGpio_Base + PORT_CTL_REG_OFFSET) != Shadow->Pctl) ? PORT_SHADOW_DRIFT_PCTL : 0U;
+          Port_Drift |= (PORT_READ_REG(PortGpio_Base + PORT_PULL_UP_REG_OFFSET) != Shadow->Pur) ? PORT_SHADOW_DRIFT_PUR : 0U;
+          Port_Drift |= (PORT_READ_REG(PortGpio_Base + PORT_PULL_DOWN_REG_OFFSET) != Shadow->Pdr) ? PORT_SHADOW_DRIFT_PDR : 0U;
+          Port_Drift |= (PORT_READ_REG(PortGpio_Base + PORT_OPEN_DRAIN_REG_OFFSET) != Shadow->Odr) ? PORT_SHADOW_DRIFT_ODR : 0U;
+        }
+        else
+        {
+          /* Do Nothing ... Unused port, its registers are neither shadowed nor clocked */
+        }
+        
+        Drift[Port_Num] = Port_Drift;
+        Result = (Port_Drift != 0) ? E_NOT_OK : Result;
+      }
+      
+      PORT_API_EXIT(Port_CheckShadow_SID);
+      
+      return Result;
+}
+#endif
+
+
+#if (PORT_VERIFY_CONFIG_API == STD_ON)
+/* Compares the Mask bits of the register at Offset of port Port_Num with Expected as one word,
+ * repairs them with PORT_VERIFY_REPAIR and returns Drift_Bit if they differ, 0 otherwise */
+STATIC uint8 Port_VerifyRegister( uint8 Port_Num, uint16 Offset, uint32 Mask, uint32 Expected, uint8 Drift_Bit )
+{
+  uint32 Address = Port_BaseAddress[Port_Num] + Offset;
+  uint32 Actual;
+  
+  if(Mask == 0)
+  {
+    /* Do Nothing ... No bit of this register is fixed by the configuration */
+    return 0U;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  
+  Actual = PORT_READ_REG(Address);
+  if(((Actual ^ Expected) & Mask) == 0)
+  {
+    return 0U;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  
+#if (PORT_VERIFY_REPAIR == STD_ON)
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+  uint32 * Shadow = Port_ShadowOf(Port_Num, Offset);
+  
+  *Shadow = (*Shadow & ~Mask) | (Expected & Mask);
+#endif
+  PORT_WRITE_REG(Address , (Actual & ~Mask) | (Expected & Mask));    /* Corrected from the word already read, no second read */
+#endif
+  
+  return Drift_Bit;
+}
+#endif
+
+
+/************************************************************************************
+* Service Name: Port_VerifyConfig
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Mismatch -Array of PORT_NUMBER_OF_PORTS entries, each one receives the
+*                             PORT_SHADOW_DRIFT_xxx bits of the registers of that port whose
+*                             content differs from the configuration (0 for unused ports)
+* Return value: Std_ReturnType -E_OK if all checked registers match, E_NOT_OK otherwise
+* Description: -Readback check against single event upsets and rogue writes: the registers of every
+*               used port are compared as whole words with the register images of the applied set,
+*               restricted to the bits the runtime APIs cannot change: GPIODIR of the unchangeable
+*               directions, GPIOAMSEL/GPIOAFSEL/GPIODEN/GPIOPCTL of the unchangeable modes and the
+*               pull resistors of all owned pins
+*              -A register with no such bit is not read, a full check is at most 7 reads per port
+*              -With PORT_VERIFY_REPAIR the mismatching bits are written back (shadow included)
+************************************************************************************/
+
+#if (PORT_VERIFY_CONFIG_API == STD_ON)
+Std_ReturnType Port_VerifyConfig( uint8* Mismatch )
+{
+  Std_ReturnType Result = E_OK;
+  
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_VerifyConfig_SID,
+                        PORT_E_UNINIT);
+        return E_NOT_OK;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      if (NULL_PTR == Mismatch)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_VerifyConfig_SID,
+                        PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      PORT_API_ENTER(Port_VerifyConfig_SID);
+      
+      for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+      {
+        const Port_PortImage * Image = &Port_PinConfigPtr->Port[Port_Num];
+        uint8 Port_Mismatch = 0;
+        
+        if(Image->Mask != 0)
+        {
+          Port_Mismatch |= Port_VerifyRegister(Port_Num, PORT_DIR_REG_OFFSET, Image->Dir_Locked, Image->Dir, PORT_SHADOW_DRIFT_DIR);
+          Port_Mismatch |= Port_VerifyRegister(Port_Num, PORT_DIGITAL_ENABLE_REG_OFFSET, Image->Mode_Locked, Image->Den, PORT_SHADOW_DRIFT_DEN);
+          Port_Mismatch |= Port_VerifyRegister(Port_Num, PORT_ALT_FUNC_REG_OFFSET, Image->Mode_Locked, Image->Afsel, PORT_SHADOW_DRIFT_AFSEL);
+          Port_Mismatch |= Port_VerifyRegister(Port_Num, PORT_ANALOG_MODE_SEL_REG_OFFSET, Image->Mode_Locked, Image->Amsel, PORT_SHADOW_DRIFT_AMSEL);
+          Port_Mismatch |= Port_VerifyRegister(Port_Num, PORT_CTL_REG_OFFSET, Image->Pctl_Locked, Image->Pctl, PORT_SHADOW_DRIFT_PCTL);
+          Port_Mismatch |= Port_VerifyRegister(Port_Num, PORT_PULL_UP_REG_OFFSET, Image->Mask, Image->Pur, PORT_SHADOW_DRIFT_PUR);
+          Port_Mismatch |= Port_VerifyRegister(Port_Num, PORT_PULL_DOWN_REG_OFFSET, Image->Mask, Image->Pdr, PORT_SHADOW_DRIFT_PDR);
+        }
+        else
+        {
+          /* Do Nothing ... Unused port, not clocked */
+        }
+        
+        Mismatch[Port_Num] = Port_Mismatch;
+        Result = (Port_Mismatch != 0) ? E_NOT_OK : Result;
+      }
+      
+      PORT_API_EXIT(Port_VerifyConfig_SID);
+      
+      return Result;
+}
+#endif
+
+
+/************************************************************************************
+* Service Name: Port_GetStatistics
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Statistics -Pointer to where to store the statistics of all APIs
+* Return value: None
+* Description: -Copies the call count and the min, max and total execution time of every API,
+*               indexed by service ID, in DWT cycles on target and nanoseconds on host
+************************************************************************************/
+
+#if (PORT_STATISTICS_API == STD_ON)
+void Port_GetStatistics( Port_StatisticsType* Statistics )
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (NULL_PTR == Statistics)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_GetStatistics_SID,
+                        PORT_E_PARAM_POINTER);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      /* One API at a time, its record is consistent and the interrupts are masked only briefly */
+      for(uint8 ApiId = 0; ApiId < PORT_NUMBER_OF_SIDS; ApiId++)
+      {
+        PORT_ENTER_CRITICAL();
+        Statistics->Api[ApiId] = Port_Statistics.Api[ApiId];
+        PORT_EXIT_CRITICAL();
+      }
+}
+#endif
+
+
+/************************************************************************************
+* Service Name: Port_SwitchConfig
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): From -Configuration set currently applied (the one of Port_Init or of the last switch)
+*                  To   -Configuration set to apply
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: -Changes the active configuration set by applying the register updates precomputed
+*               by tools/Port_Generator.py in Port_ConfigSwitches, only the bits that differ between
+*               the two sets (and the pins only To owns) are written, in the Port_Init register order
+*              -Ports only used by To are clocked first, the pins only owned by From keep their state
+*              -The pins of To with a changeable direction or mode are then taken back to the direction
+*               and mode of To, whatever Port_SetPinDirection(s)/Port_SetPinMode(s) did since the last
+*               switch. With PORT_SHADOW_REGISTERS only the registers differing from To are written
+*              -Output levels written at runtime are kept where both sets have the same initial level
+*              -Switching to the current set is a no operation
+************************************************************************************/
+
+void Port_SwitchConfig( const Port_ConfigType* From, const Port_ConfigType* To )
+{
+  const Port_ConfigSwitchType * Switch = Port_ConfigSwitches;
+  
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_SwitchConfig_SID,
+                        PORT_E_UNINIT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      /* Look up the precomputed switch From -> To */
+      while((Switch->From != NULL_PTR) && ((Switch->From != From) || (Switch->To != To)))
+      {
+        Switch++;
+      }
+      
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      /* From must be the applied set and the switch must have been generated, Port_Init applies any other set */
+      if ((From != Port_PinConfigPtr) || ((Switch->From == NULL_PTR) && (From != To)))
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_SwitchConfig_SID,
+                        PORT_E_PARAM_CONFIG);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      if(Switch->From == NULL_PTR)
+      {
+        /* Do Nothing ... Same set or no precomputed switch */
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      PORT_API_ENTER(Port_SwitchConfig_SID);
+      
+      uint32 New_Ports = To->Clock_Mask & ~From->Clock_Mask;
+      
+      if(New_Ports != 0)
+      {
+        Port_EnableClocks(New_Ports);
+        
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+        for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+        {
+          if((New_Ports & (1UL << Port_Num)) != 0)
+          {
+            Port_LoadShadow(Port_Num);
+          }
+          else
+          {
+            /* Do Nothing */
+          }
+        }
+#endif
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      for(uint16 Index = 0; Index < Switch->Count; Index++)
+      {
+        Port_ApplyDelta(&Switch->Delta[Index]);
+      }
+      
+      /* The deltas assume the registers hold From, the runtime changes of the changeable pins are undone here */
+      Port_RestoreChangeable(To);
+      
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+      /* The deltas armed the pins of To, their ports need their vectors */
+      Port_EnableInterrupts(To);
+#endif
+      
+      Port_PinConfigPtr = To;
+      
+#if (PORT_DEBOUNCE_API == STD_ON)
+      /* The debounced pins or their sample counts may differ, debouncing starts over from the current levels */
+      Port_ResetDebounce(To);
+#endif
+      
+#if (PORT_SNAPSHOT_API == STD_ON)
+      /* The configured pins may differ, the next snapshot starts a new comparison */
+      Port_SnapshotPrevious = Port_SnapshotCurrent;
+      Port_SnapshotTaken = FALSE;
+#endif
+      
+      PORT_API_EXIT(Port_SwitchConfig_SID);
+}
+
+
+/************************************************************************************
+* Service Name: Port_DebounceTick
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: -Cyclic sampling of the debounced pins, to be called at the debouncing period
+*              -Each port with debounced pins is read once through its group GPIODATA address and its
+*               8 pins are debounced together on bit-sliced down counters (vertical counters): a pin
+*               differing from its debounced level counts one sample down, a pin equal to it reloads
+*               its count, a pin differing with an expired count takes the new level. The cost per
+*               tick only depends on the number of sampled ports
+*              -Silently does nothing before Port_Init
+************************************************************************************/
+
+#if (PORT_DEBOUNCE_API == STD_ON)
+void Port_DebounceTick( void )
+{
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      PORT_API_ENTER(Port_DebounceTick_SID);
+      
+      for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+      {
+        const Port_DebounceImageType * Image = &Port_PinConfigPtr->Debounce[Port_Num];
+        Port_DebounceStateType * Debounce = &Port_Debounce[Port_Num];
+        
+        if(Image->Mask == 0)
+        {
+          /* Do Nothing ... No debounced pin on this port */
+          continue;
+        }
+        
+        uint32 Sample = PORT_READ_REG(Port_PinConfigPtr->Group[Port_Num].Data_Address);
+        uint32 Differ = (Sample ^ Debounce->Level) & Image->Mask;
+        uint32 Expired = Differ & ~(Debounce->Count0 | Debounce->Count1 | Debounce->Count2);
+        uint32 Counting = Differ & ~Expired;
+        uint32 Borrow1 = ~Debounce->Count0;               /* Borrows of the decrement into planes 1 and 2 */
+        uint32 Borrow2 = Borrow1 & ~Debounce->Count1;
+        
+        Debounce->Level ^= Expired;
+        
+        /* Counting pins are decremented, the others restart from their reload value */
+        Debounce->Count2 = (Counting & (Debounce->Count2 ^ Borrow2)) | (~Counting & Image->Reload2);
+        Debounce->Count1 = (Counting & (Debounce->Count1 ^ Borrow1)) | (~Counting & Image->Reload1);
+        Debounce->Count0 = (Counting & ~Debounce->Count0) | (~Counting & Image->Reload0);
+      }
+      
+      PORT_API_EXIT(Port_DebounceTick_SID);
+}
+
+
+/************************************************************************************
+* Service Name: Port_GetDebouncedLevel
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Pin -Port Pin ID number, configured with a PORT_PIN_DEBOUNCE_* attribute
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint8 -Debounced level of the pin (STD_HIGH or STD_LOW)
+* Description: -Returns the level accepted by the last Port_DebounceTick calls, no register access
+************************************************************************************/
+
+uint8 Port_GetDebouncedLevel( Port_PinType Pin )
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_GetDebouncedLevel_SID,
+                        PORT_E_UNINIT);
+        return STD_LOW;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      /* check if the Pin is invalid or not debounced */
+      if ((Pin >= PORT_CONFIGURED_PINS) || (PORT_PIN_CFG_DEBOUNCE(Port_PinConfigPtr->Pin[Pin]) == 0))
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_GetDebouncedLevel_SID,
+                        PORT_E_PARAM_PIN);
+        return STD_LOW;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      return ((Port_Debounce[PORT_PIN_CFG_PORT_NUM(Port_PinConfigPtr->Pin[Pin])].Level & Port_PinConfigPtr->Pin_Desc[Pin].Mask) != 0U) ? STD_HIGH : STD_LOW;
+}
+
+
+/************************************************************************************
+* Service Name: Port_GetDebouncedPort
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Port_Num -Port number (PORT_PORTA ... PORT_PORTF)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint8 -Debounced levels of the debounced pins of the port, bit n for pin n,
+*                      0 for the other pins
+* Description: -Returns the levels accepted by the last Port_DebounceTick calls, no register access
+************************************************************************************/
+
+uint8 Port_GetDebouncedPort( uint8 Port_Num )
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_GetDebouncedPort_SID,
+                        PORT_E_UNINIT);
+        return 0U;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      /* check if the Port Number is invalid */
+      if (Port_Num >= PORT_NUMBER_OF_PORTS)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_GetDebouncedPort_SID,
+                        PORT_E_PARAM_INVALID_PORT);
+        return 0U;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      return (uint8)Port_Debounce[Port_Num].Level;
+}
+#endif
+
+
+/************************************************************************************
+* Service Name: Port_Snapshot
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 -Levels of the configured pins, PORT_SNAPSHOT_BIT(port, pin) set for a high pin,
+*                       0 for the pins outside the configuration
+* Description: -Reads every used port once through its group GPIODATA address, masked to its configured
+*               pins, and packs the ports byte by byte in one 64-bit image
+*              -The image is kept with the previous one for Port_GetEdges, the first snapshot after
+*               Port_Init or Port_SwitchConfig is its own previous one (no edge)
+************************************************************************************/
+
+#if (PORT_SNAPSHOT_API == STD_ON)
+uint64 Port_Snapshot( void )
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_Snapshot_SID,
+                        PORT_E_UNINIT);
+        return 0U;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      uint64 Image = 0;
+      
+      PORT_API_ENTER(Port_Snapshot_SID);
+      
+      for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+      {
+        if(Port_PinConfigPtr->Port[Port_Num].Mask != 0)
+        {
+          Image |= (uint64)PORT_READ_REG(Port_PinConfigPtr->Group[Port_Num].Data_Address) << (Port_Num * PORT_PINS_PER_PORT);
+        }
+        else
+        {
+          /* Do Nothing ... Unused ports are not clocked */
+        }
+      }
+      
+      Port_SnapshotPrevious = Port_SnapshotTaken ? Port_SnapshotCurrent : Image;
+      Port_SnapshotCurrent = Image;
+      Port_SnapshotTaken = TRUE;
+      
+      PORT_API_EXIT(Port_Snapshot_SID);
+      return Image;
+}
+
+
+/************************************************************************************
+* Service Name: Port_GetEdges
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Rising  -Pins low in the previous snapshot and high in the last one
+*                   Falling -Pins high in the previous snapshot and low in the last one
+* Return value: None
+* Description: -Compares the last two Port_Snapshot images with one XOR and two ANDs, no register access.
+*               Edges between two snapshots that cancel out are not seen
+************************************************************************************/
+
+void Port_GetEdges( uint64* Rising, uint64* Falling )
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_GetEdges_SID,
+                        PORT_E_UNINIT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      /* check if the output pointers are not NULL_PTR */
+      if ((NULL_PTR == Rising) || (NULL_PTR == Falling))
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_GetEdges_SID,
+                        PORT_E_PARAM_POINTER);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      uint64 Changed = Port_SnapshotCurrent ^ Port_SnapshotPrevious;
+      
+      *Rising = Changed & Port_SnapshotCurrent;
+      *Falling = Changed & Port_SnapshotPrevious;
+}
+#endif
+
+
+/************************************************************************************
+* Service Name: Port_SaveState
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): State -RAM context receiving the registers of the used ports
+* Return value: None
+* Description: -Copies GPIOAMSEL, GPIOAFSEL, GPIOPCTL, GPIOPUR, GPIOPDR, GPIOODR, GPIODATA, GPIODIR,
+*               GPIODEN and the interrupt sense and mask of every used port, to be written back by
+*               Port_RestoreState after a low power phase
+*              -With PORT_SHADOW_REGISTERS the shadowed registers are copied from the shadow, only
+*               GPIODATA and the 4 interrupt registers are read
+************************************************************************************/
+
+#if (PORT_SLEEP_API == STD_ON)
+void Port_SaveState( Port_StateType* State )
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_SaveState_SID,
+                        PORT_E_UNINIT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      /* check if the output pointer is not a NULL_PTR */
+      if (NULL_PTR == State)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_SaveState_SID,
+                        PORT_E_PARAM_POINTER);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      PORT_API_ENTER(Port_SaveState_SID);
+      
+      State->Clock_Mask = Port_PinConfigPtr->Clock_Mask;
+      
+      for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+      {
+        uint32 PortGpio_Base = Port_BaseAddress[Port_Num];
+        Port_PortStateType * Saved = &State->Port[Port_Num];
+        
+        if(Port_PinConfigPtr->Port[Port_Num].Mask == 0)
+        {
+          /* Do Nothing ... Unused ports are not clocked */
+          continue;
+        }
+        
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+        const Port_ShadowType * Shadow = &Port_Shadow[Port_Num];
+        
+        Saved->Amsel = Shadow->Amsel;
+        Saved->Afsel = Shadow->Afsel;
+        Saved->Pctl  = Shadow->Pctl;
+        Saved->Pur   = Shadow->Pur;
+        Saved->Pdr   = Shadow->Pdr;
+        Saved->Odr   = Shadow->Odr;
+        Saved->Dir   = Shadow->Dir;
+        Saved->Den   = Shadow->Den;
+#else
+        Saved->Amsel = PORT_READ_REG(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET);
+        Saved->Afsel = PORT_READ_REG(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET);
+        Saved->Pctl  = PORT_READ_REG(PortGpio_Base + PORT_CTL_REG_OFFSET);
+        Saved->Pur   = PORT_READ_REG(PortGpio_Base + PORT_PULL_UP_REG_OFFSET);
+        Saved->Pdr   = PORT_READ_REG(PortGpio_Base + PORT_PULL_DOWN_REG_OFFSET);
+        Saved->Odr   = PORT_READ_REG(PortGpio_Base + PORT_OPEN_DRAIN_REG_OFFSET);
+        Saved->Dir   = PORT_READ_REG(PortGpio_Base + PORT_DIR_REG_OFFSET);
+        Saved->Den   = PORT_READ_REG(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET);
+#endif
+        Saved->Data  = PORT_READ_REG(PortGpio_Base + PORT_DATA_REG_OFFSET);
+        Saved->Is    = PORT_READ_REG(PortGpio_Base + PORT_INT_SENSE_REG_OFFSET);
+        Saved->Ibe   = PORT_READ_REG(PortGpio_Base + PORT_INT_BOTH_EDGES_REG_OFFSET);
+        Saved->Iev   = PORT_READ_REG(PortGpio_Base + PORT_INT_EVENT_REG_OFFSET);
+        Saved->Im    = PORT_READ_REG(PortGpio_Base + PORT_INT_MASK_REG_OFFSET);
+      }
+      
+      PORT_API_EXIT(Port_SaveState_SID);
+}
+
+
+/************************************************************************************
+* Service Name: Port_RestoreState
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): State -RAM context filled by Port_SaveState under the active configuration set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: -Writes back the saved registers of every used port with 14 stores per port and no read:
+*               the pins are disarmed first, then the registers are written in the Port_Init order
+*               (output levels before directions) and the interrupt mask last
+*              -The output levels are written through the GPIODATA address masked to the owned pins,
+*               as Port_WritePortLevel does, the pins outside the configuration keep their level
+*              -Pending interrupts are not acknowledged, a wake up edge is still dispatched once its
+*               pin is armed again
+*              -The shadow takes the restored values
+************************************************************************************/
+
+void Port_RestoreState( const Port_StateType* State )
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_RestoreState_SID,
+                        PORT_E_UNINIT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      /* check if the input pointer is not a NULL_PTR */
+      if (NULL_PTR == State)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_RestoreState_SID,
+                        PORT_E_PARAM_POINTER);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+      
+      /* The state must have been saved with the used ports of the active configuration set */
+      if (State->Clock_Mask != Port_PinConfigPtr->Clock_Mask)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_RestoreState_SID,
+                        PORT_E_PARAM_CONFIG);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      PORT_API_ENTER(Port_RestoreState_SID);
+      
+      for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+      {
+        uint32 PortGpio_Base = Port_BaseAddress[Port_Num];
+        const Port_PortStateType * Saved = &State->Port[Port_Num];
+        
+        if(Port_PinConfigPtr->Port[Port_Num].Mask == 0)
+        {
+          /* Do Nothing ... Unused ports are not clocked */
+          continue;
+        }
+        
+        PORT_WRITE_REG(PortGpio_Base + PORT_INT_MASK_REG_OFFSET , 0U);
+        PORT_STORE_REG(Port_Num , Amsel , PORT_ANALOG_MODE_SEL_REG_OFFSET , Saved->Amsel);
+        PORT_STORE_REG(Port_Num , Afsel , PORT_ALT_FUNC_REG_OFFSET , Saved->Afsel);
+        PORT_STORE_REG(Port_Num , Pctl , PORT_CTL_REG_OFFSET , Saved->Pctl);
+        PORT_STORE_REG(Port_Num , Pur , PORT_PULL_UP_REG_OFFSET , Saved->Pur);
+        PORT_STORE_REG(Port_Num , Pdr , PORT_PULL_DOWN_REG_OFFSET , Saved->Pdr);
+        PORT_STORE_REG(Port_Num , Odr , PORT_OPEN_DRAIN_REG_OFFSET , Saved->Odr);
+        PORT_WRITE_REG(Port_PinConfigPtr->Group[Port_Num].Data_Address , Saved->Data);   /* output levels of the owned pins only */
+        PORT_STORE_REG(Port_Num , Dir , PORT_DIR_REG_OFFSET , Saved->Dir);
+        PORT_STORE_REG(Port_Num , Den , PORT_DIGITAL_ENABLE_REG_OFFSET , Saved->Den);
+        PORT_WRITE_REG(PortGpio_Base + PORT_INT_SENSE_REG_OFFSET , Saved->Is);
+        PORT_WRITE_REG(PortGpio_Base + PORT_INT_BOTH_EDGES_REG_OFFSET , Saved->Ibe);
+        PORT_WRITE_REG(PortGpio_Base + PORT_INT_EVENT_REG_OFFSET , Saved->Iev);
+        PORT_WRITE_REG(PortGpio_Base + PORT_INT_MASK_REG_OFFSET , Saved->Im);
+      }
+      
+      PORT_API_EXIT(Port_RestoreState_SID);
+}
+
+
+/************************************************************************************
+* Service Name: Port_EnterSleep
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: -Puts the pins with a PORT_PIN_SLEEP_* attribute of the active configuration set in
+*               their low power state from the sleep images precomputed by tools/Port_Generator.py,
+*               at most 7 stores per port in the Port_Init order, the other pins are not touched
+*              -With PORT_SHADOW_REGISTERS no register is read
+*              -Port_SaveState is to be called before, Port_RestoreState on wake up
+************************************************************************************/
+
+void Port_EnterSleep( void )
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      if (Port_Status == PORT_NOT_INITIALIZED)
+      {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        Port_EnterSleep_SID,
+                        PORT_E_UNINIT);
+        return;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+#endif
+      
+      PORT_API_ENTER(Port_EnterSleep_SID);
+      
+      for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+      {
+        const Port_SleepImageType * Image = &Port_PinConfigPtr->Sleep[Port_Num];
+        
+        if(Image->Mask == 0)
+        {
+          /* Do Nothing ... The port keeps its state */
+          continue;
+        }
+        
+        PORT_UPDATE_REG(Port_Num , Amsel , PORT_ANALOG_MODE_SEL_REG_OFFSET , Image->Mask , Image->Amsel);
+        PORT_UPDATE_REG(Port_Num , Afsel , PORT_ALT_FUNC_REG_OFFSET , Image->Mask , Image->Afsel);
+        PORT_UPDATE_REG(Port_Num , Pur , PORT_PULL_UP_REG_OFFSET , Image->Mask , Image->Pur);
+        PORT_UPDATE_REG(Port_Num , Pdr , PORT_PULL_DOWN_REG_OFFSET , Image->Mask , Image->Pdr);
+        PORT_WRITE_REG(Image->Data_Address , Image->Data);
+        PORT_UPDATE_REG(Port_Num , Dir , PORT_DIR_REG_OFFSET , Image->Mask , Image->Dir);
+        PORT_UPDATE_REG(Port_Num , Den , PORT_DIGITAL_ENABLE_REG_OFFSET , Image->Mask , Image->Den);
+      }
+      
+      PORT_API_EXIT(Port_EnterSleep_SID);
+}
+#endif
+
+
+/************************************************************************************
+* Service Name: GPIOA_Handler to GPIOF_Handler
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: -Interrupt vectors of the GPIO ports A to F, placed in the vector table of cstartup_M.c
+*              -Acknowledge the pending pins of their port and call their Port_PinNotifications,
+*               highest pin number first
+************************************************************************************/
+
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+void GPIOA_Handler( void )
+{
+  Port_DispatchIrq(PORT_PORTA);
+}
+
+void GPIOB_Handler( void )
+{
+  Port_DispatchIrq(PORT_PORTB);
+}
+
+void GPIOC_Handler( void )
+{
+  Port_DispatchIrq(PORT_PORTC);
+}
+
+void GPIOD_Handler( void )
+{
+  Port_DispatchIrq(PORT_PORTD);
+}
+
+void GPIOE_Handler( void )
+{
+  Port_DispatchIrq(PORT_PORTE);
+}
+
+void GPIOF_Handler( void )
+{
+  Port_DispatchIrq(PORT_PORTF);
+}
+#endif
@@ -89,6 +89,69 @@
    
 /*Service ID for Port Pin Mode*/
 #define Port_SetPinMode_SID             (uint8)0x04
+   
+/*Service ID for Port Pin Level Write*/
+#define Port_WritePinLevel_SID          (uint8)0x05
+   
+/*Service ID for Port Level Write*/
+#define Port_WritePortLevel_SID         (uint8)0x06
+   
+/*Service ID for Port Statistics*/
+#define Port_GetStatistics_SID          (uint8)0x07
+
+/*Service ID for Port Group Pin Direction*/
+#define Port_SetPinDirections_SID       (uint8)0x08
+
+/*Service ID for Port Group Pin Mode*/
+#define Port_SetPinModes_SID            (uint8)0x09
+
+/*Service ID for Port Shadow Check*/
+#define Port_CheckShadow_SID            (uint8)0x0A
+
+/*Service ID for Port Configuration Switch*/
+#define Port_SwitchConfig_SID           (uint8)0x0B
+
+/*Service ID for Port Early Init*/
+#define Port_EarlyInit_SID              (uint8)0x0C
+
+/*Service ID for Port Main Function*/
+#define Port_MainFunction_SID           (uint8)0x0D
+
+/*Service ID for Port Configuration Verification*/
+#define Port_VerifyConfig_SID           (uint8)0x0E
+
+/*Service ID for the GPIO interrupt dispatch of the port vectors*/
+#define Port_Isr_SID                    (uint8)0x0F
+
+/*Service ID for Port Debounce Tick*/
+#define Port_DebounceTick_SID           (uint8)0x10
+
+/*Service ID for Port Debounced Pin Level*/
+#define Port_GetDebouncedLevel_SID      (uint8)0x11
+
+/*Service ID for Port Debounced Port Levels*/
+#define Port_GetDebouncedPort_SID       (uint8)0x12
+
+/*Service ID for Port Input Snapshot*/
+#define Port_Snapshot_SID               (uint8)0x13
+
+/*Service ID for Port Snapshot Edges*/
+#define Port_GetEdges_SID               (uint8)0x14
+
+/*Service ID for Port State Save*/
+#define Port_SaveState_SID              (uint8)0x15
+
+/*Service ID for Port State Restore*/
+#define Port_RestoreState_SID           (uint8)0x16
+
+/*Service ID for Port Sleep Entry*/
+#define Port_EnterSleep_SID             (uint8)0x17
+
+/*Service ID for Port Main Function Drift Status*/
+#define Port_GetMainFunctionDrift_SID   (uint8)0x18
+
+/*Number of service IDs, each one has an entry in Port_StatisticsType*/
+#define PORT_NUMBER_OF_SIDS             (25U)
  
    
 /*******************************************************************************
@@ -146,26 +209,272 @@ typedef enum
   
 }Port_PinInitMode;
 
-/*Type definition Structure to Configure all the Port Pins used by PORT APIs*/
-typedef struct 
+/*Type definition to Configure one Port Pin used by PORT APIs, all the attributes are packed in one word*/
+typedef uint32 Pin_Config;
+
+/*
+ * Bit fields of Pin_Config
+ */
+#define PORT_PIN_CFG_PORT_NUM_SHIFT           (0U)
+#define PORT_PIN_CFG_PORT_NUM_MASK            (0x7U)
+#define PORT_PIN_CFG_PIN_NUM_SHIFT            (3U)
+#define PORT_PIN_CFG_PIN_NUM_MASK             (0x7U)
+#define PORT_PIN_CFG_DIRECTION_SHIFT          (6U)
+#define PORT_PIN_CFG_DIRECTION_MASK           (0x1U)
+#define PORT_PIN_CFG_CHANGE_DIRECTION_SHIFT   (7U)
+#define PORT_PIN_CFG_CHANGE_DIRECTION_MASK    (0x1U)
+#define PORT_PIN_CFG_MODE_SHIFT               (8U)
+#define PORT_PIN_CFG_MODE_MASK                (0xFU)
+#define PORT_PIN_CFG_CHANGE_MODE_SHIFT        (12U)
+#define PORT_PIN_CFG_CHANGE_MODE_MASK         (0x1U)
+#define PORT_PIN_CFG_INIT_VALUE_SHIFT         (13U)
+#define PORT_PIN_CFG_INIT_VALUE_MASK          (0x1U)
+#define PORT_PIN_CFG_PULL_RESISTOR_SHIFT      (14U)
+#define PORT_PIN_CFG_PULL_RESISTOR_MASK       (0x3U)
+#define PORT_PIN_CFG_PRIORITY_SHIFT           (16U)
+#define PORT_PIN_CFG_PRIORITY_MASK            (0x1U)
+#define PORT_PIN_CFG_INTERRUPT_SHIFT          (17U)
+#define PORT_PIN_CFG_INTERRUPT_MASK           (0x7U)
+#define PORT_PIN_CFG_DEBOUNCE_SHIFT           (20U)
+#define PORT_PIN_CFG_DEBOUNCE_MASK            (0x7U)
+#define PORT_PIN_CFG_SLEEP_SHIFT              (23U)
+#define PORT_PIN_CFG_SLEEP_MASK               (0x7U)
+
+/* Packs the attributes of one pin into its Pin_Config word */
+#define PORT_PIN_CONFIG(PORT_NUM,PIN_NUM,DIRECTION,CHANGE_DIRECTION,MODE,CHANGE_MODE,INIT_VALUE,PULL_RESISTOR) \
+  ( ((uint32)(PORT_NUM)         << PORT_PIN_CFG_PORT_NUM_SHIFT)         \
+  | ((uint32)(PIN_NUM)          << PORT_PIN_CFG_PIN_NUM_SHIFT)          \
+  | ((uint32)(DIRECTION)        << PORT_PIN_CFG_DIRECTION_SHIFT)        \
+  | ((uint32)(CHANGE_DIRECTION) << PORT_PIN_CFG_CHANGE_DIRECTION_SHIFT) \
+  | ((uint32)(MODE)             << PORT_PIN_CFG_MODE_SHIFT)             \
+  | ((uint32)(CHANGE_MODE)      << PORT_PIN_CFG_CHANGE_MODE_SHIFT)      \
+  | ((uint32)(INIT_VALUE)       << PORT_PIN_CFG_INIT_VALUE_SHIFT)       \
+  | ((uint32)(PULL_RESISTOR)    << PORT_PIN_CFG_PULL_RESISTOR_SHIFT) )
+
+/* Optional attributes OR-ed to a PORT_PIN_CONFIG word */
+#define PORT_PIN_CRITICAL                     (0x00010000U)   /* PRIORITY set, safe state pin configured by Port_EarlyInit */
+#define PORT_PIN_IRQ_FALLING_EDGE             (0x00020000U)   /* INTERRUPT values, the pin is armed in GPIOIM by Port_Init */
+#define PORT_PIN_IRQ_RISING_EDGE              (0x00040000U)
+#define PORT_PIN_IRQ_BOTH_EDGES               (0x00060000U)
+#define PORT_PIN_IRQ_LOW_LEVEL                (0x00080000U)
+#define PORT_PIN_IRQ_HIGH_LEVEL               (0x000A0000U)
+#define PORT_PIN_DEBOUNCE_2                   (0x00100000U)   /* DEBOUNCE values, samples - 1: a new level is accepted */
+#define PORT_PIN_DEBOUNCE_4                   (0x00300000U)   /* after that many equal Port_DebounceTick samples */
+#define PORT_PIN_DEBOUNCE_8                   (0x00700000U)
+#define PORT_PIN_SLEEP_DISABLED               (0x00800000U)   /* SLEEP values, GPIO state of Port_EnterSleep: input buffer and pulls off */
+#define PORT_PIN_SLEEP_PULL_DOWN              (0x01000000U)   /* input with pull-down */
+#define PORT_PIN_SLEEP_PULL_UP                (0x01800000U)   /* input with pull-up */
+#define PORT_PIN_SLEEP_OUT_LOW                (0x02000000U)   /* output driven low */
+#define PORT_PIN_SLEEP_OUT_HIGH               (0x02800000U)   /* output driven high */
+
+/* Accessors of the attributes packed in a Pin_Config word */
+#define PORT_PIN_CFG_FIELD(CFG,FIELD)         (((CFG) >> PORT_PIN_CFG_##FIELD##_SHIFT) & PORT_PIN_CFG_##FIELD##_MASK)
+#define PORT_PIN_CFG_PORT_NUM(CFG)            ((uint8)PORT_PIN_CFG_FIELD(CFG, PORT_NUM))
+#define PORT_PIN_CFG_PIN_NUM(CFG)             ((uint8)PORT_PIN_CFG_FIELD(CFG, PIN_NUM))
+#define PORT_PIN_CFG_DIRECTION(CFG)           ((Port_PinDirectionType)PORT_PIN_CFG_FIELD(CFG, DIRECTION))
+#define PORT_PIN_CFG_CHANGE_DIRECTION(CFG)    ((Port_PinChange)PORT_PIN_CFG_FIELD(CFG, CHANGE_DIRECTION))
+#define PORT_PIN_CFG_MODE(CFG)                ((Port_PinInitMode)PORT_PIN_CFG_FIELD(CFG, MODE))
+#define PORT_PIN_CFG_CHANGE_MODE(CFG)         ((Port_PinChange)PORT_PIN_CFG_FIELD(CFG, CHANGE_MODE))
+#define PORT_PIN_CFG_INIT_VALUE(CFG)          ((Port_PinInitValue)PORT_PIN_CFG_FIELD(CFG, INIT_VALUE))
+#define PORT_PIN_CFG_PULL_RESISTOR(CFG)       ((PORT_PinPullResistor)PORT_PIN_CFG_FIELD(CFG, PULL_RESISTOR))
+#define PORT_PIN_CFG_PRIORITY(CFG)            ((uint8)PORT_PIN_CFG_FIELD(CFG, PRIORITY))
+#define PORT_PIN_CFG_INTERRUPT(CFG)           ((uint8)PORT_PIN_CFG_FIELD(CFG, INTERRUPT))
+#define PORT_PIN_CFG_DEBOUNCE(CFG)            ((uint8)PORT_PIN_CFG_FIELD(CFG, DEBOUNCE))
+#define PORT_PIN_CFG_SLEEP(CFG)               ((uint8)PORT_PIN_CFG_FIELD(CFG, SLEEP))
+
+/*Type definition for the register images of one port ready to be written by Port_Init (generated by tools/Port_Generator.py)*/
+typedef struct
 {
-  uint8 Port_Num;
-  uint8 Pin_Num;
-  Port_PinDirectionType Direction;
-  Port_PinChange Pin_Change_Direction;
-  Port_PinInitMode Pin_Mode;
-  Port_PinChange Pin_Change_Mode;
-  Port_PinInitValue Init_Value;
-  PORT_PinPullResistor Pull_Resistor;
+  uint32 Mask;        /* Pins of the port owned by the configuration */
+  uint32 Pctl_Mask;   /* PMCx fields of the owned pins */
+  uint32 Commit;      /* Locked pins of the configuration that need their GPIOCR bit to be set */
+  uint32 Amsel;
+  uint32 Den;
+  uint32 Afsel;
+  uint32 Pctl;
+  uint32 Dir;
+  uint32 Dir_Locked;  /* Pins whose direction is not changeable at runtime, restored by Port_RefreshPortDirection */
+  uint32 Data;
+  uint32 Pur;
+  uint32 Pdr;
+  uint32 Mode_Locked; /* Pins whose mode is not changeable at runtime, checked by Port_VerifyConfig */
+  uint32 Pctl_Locked; /* PMCx fields of the same pins */
+  
+}Port_PortImage;
+
+/*Type definition for the interrupt register images of one port (generated by tools/Port_Generator.py)*/
+typedef struct
+{
+  uint32 Im;          /* Armed pins, 0 if the port raises no interrupt */
+  uint32 Is;          /* Level sensitive pins */
+  uint32 Ibe;         /* Pins sensitive to both edges */
+  uint32 Iev;         /* Pins sensitive to the rising edge or the high level */
   
-}Pin_Config;
+}Port_IrqImageType;
+
+/*Type definition for the debouncing data of one port (generated by tools/Port_Generator.py). The sample
+  counters of the 8 pins are bit-sliced: bit n of plane k is bit k of the counter of pin n*/
+typedef struct
+{
+  uint32 Mask;        /* Debounced pins, 0 if the port is not sampled */
+  uint32 Reload0;     /* Planes 0 to 2 of the counter reload value of every pin, its DEBOUNCE field */
+  uint32 Reload1;
+  uint32 Reload2;
+  
+}Port_DebounceImageType;
+
+/*Type definition for the low power register images of one port, applied by Port_EnterSleep (generated by tools/Port_Generator.py)*/
+typedef struct
+{
+  uint32 Mask;          /* Pins with a PORT_PIN_SLEEP_* attribute, 0 if the port keeps its state */
+  uint32 Amsel;
+  uint32 Afsel;
+  uint32 Pur;
+  uint32 Pdr;
+  uint32 Data;
+  uint32 Dir;
+  uint32 Den;
+  uint32 Data_Address;  /* GPIODATA address masked to the pins of Mask */
+  
+}Port_SleepImageType;
+
+/*Type definition for the precomputed register access data of one pin (generated by tools/Port_Generator.py),
+  its masked GPIODATA address and GPIODIR bit-band alias are derived from the port base address*/
+typedef struct
+{
+  uint8 Mask;           /* Bit of the pin in the port registers */
+  uint8 Pctl_Shift;     /* Position of the pin PMCx field in GPIOPCTL */
+  
+}Port_PinDescType;
+
+/*Type definition for the precomputed addresses of the pin group of one port (generated by tools/Port_Generator.py)*/
+typedef struct
+{
+  uint32 Data_Address;  /* GPIODATA address masked to all configured pins of the port */
+  
+}Port_GroupType;
 
 typedef struct
 {
     Pin_Config Pin[PORT_CONFIGURED_PINS];
+    Port_PortImage Port[PORT_NUMBER_OF_PORTS];
+    Port_PinDescType Pin_Desc[PORT_CONFIGURED_PINS];
+    Port_GroupType Group[PORT_NUMBER_OF_PORTS];
+    uint32 Clock_Mask;    /* Ports with configured pins, bit n for port n (generated by tools/Port_Generator.py) */
+    uint8 Critical[PORT_NUMBER_OF_PORTS];             /* PORT_PIN_CRITICAL pins of every port, written by Port_EarlyInit from their Port images */
+    Port_IrqImageType Irq[PORT_NUMBER_OF_PORTS];      /* Interrupt sense and arming of every port */
+    Port_DebounceImageType Debounce[PORT_NUMBER_OF_PORTS];  /* Debounced pins and sample counts of every port */
+    Port_SleepImageType Sleep[PORT_NUMBER_OF_PORTS];        /* Low power state of the pins with a sleep attribute */
     
 }Port_ConfigType;
 
+/*Type definition for the notification called by the GPIO interrupt dispatch for one armed pin*/
+typedef void (*Port_PinNotificationType)( void );
+
+/*Type definition for one register update of a configuration switch (generated by tools/Port_Generator.py)*/
+typedef struct
+{
+  uint32 Mask;        /* Bits to update, 0xFFFFFFFF for a plain store without read */
+  uint32 Value;
+  uint16 Offset;      /* Register offset in the port, GPIODATA offsets carry the pin mask of the store */
+  uint8 Port_Num;
+  
+}Port_RegDeltaType;
+
+/*Type definition for the precomputed register updates turning configuration set From into configuration set To*/
+typedef struct
+{
+  const Port_ConfigType * From;
+  const Port_ConfigType * To;
+  const Port_RegDeltaType * Delta;    /* Updates in the Port_Init register order, NULL_PTR if the sets are identical */
+  uint16 Count;
+  
+}Port_ConfigSwitchType;
+
+/*Type definition for the RAM shadow of the runtime configurable registers of one port (PORT_SHADOW_REGISTERS)*/
+typedef struct
+{
+  uint32 Dir;
+  uint32 Den;
+  uint32 Afsel;
+  uint32 Amsel;
+  uint32 Pctl;
+  uint32 Pur;
+  uint32 Pdr;
+  uint32 Odr;
+  
+}Port_ShadowType;
+
+/*Type definition for the debouncing state of one port (PORT_DEBOUNCE_API)*/
+typedef struct
+{
+  uint32 Level;       /* Debounced levels */
+  uint32 Count0;      /* Planes 0 to 2 of the remaining samples before a differing pin takes its new level */
+  uint32 Count1;
+  uint32 Count2;
+  
+}Port_DebounceStateType;
+
+/*Type definition for the saved registers of one port*/
+typedef struct
+{
+  uint32 Amsel;
+  uint32 Afsel;
+  uint32 Pctl;
+  uint32 Pur;
+  uint32 Pdr;
+  uint32 Odr;
+  uint32 Data;
+  uint32 Dir;
+  uint32 Den;
+  uint32 Is;
+  uint32 Ibe;
+  uint32 Iev;
+  uint32 Im;
+  
+}Port_PortStateType;
+
+/*Type definition for the RAM context of Port_SaveState and Port_RestoreState (PORT_SLEEP_API)*/
+typedef struct
+{
+  uint32 Clock_Mask;                            /* Used ports when the state was saved, only they are filled */
+  Port_PortStateType Port[PORT_NUMBER_OF_PORTS];
+  
+}Port_StateType;
+
+/* Bit of pin PIN_NUM of port PORT_NUM in the 64-bit images of Port_Snapshot and Port_GetEdges */
+#define PORT_SNAPSHOT_BIT(PORT_NUM,PIN_NUM)   ((uint64)1 << (((PORT_NUM) * PORT_PINS_PER_PORT) + (PIN_NUM)))
+
+/* Registers reported by Port_CheckShadow whose content differs from their shadow,
+ * by Port_VerifyConfig whose content differs from the configuration
+ * and by Port_GetMainFunctionDrift repaired by Port_MainFunction */
+#define PORT_SHADOW_DRIFT_DIR           (uint8)0x01
+#define PORT_SHADOW_DRIFT_DEN           (uint8)0x02
+#define PORT_SHADOW_DRIFT_AFSEL         (uint8)0x04
+#define PORT_SHADOW_DRIFT_AMSEL         (uint8)0x08
+#define PORT_SHADOW_DRIFT_PCTL          (uint8)0x10
+#define PORT_SHADOW_DRIFT_PUR           (uint8)0x20
+#define PORT_SHADOW_DRIFT_PDR           (uint8)0x40
+#define PORT_SHADOW_DRIFT_ODR           (uint8)0x80
+
+/*Type definition for the execution time statistics of one API, in DWT cycles on target and nanoseconds on host*/
+typedef struct
+{
+  uint32 Calls;         /* Completed calls, the ones rejected by a development error are not counted */
+  uint32 Min;
+  uint32 Max;
+  uint64 Total;
+  
+}Port_ApiStatisticsType;
+
+/*Type definition for the statistics of all APIs, indexed by service ID*/
+typedef struct
+{
+  Port_ApiStatisticsType Api[PORT_NUMBER_OF_SIDS];
+  
+}Port_StatisticsType;
+
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -187,6 +496,21 @@ typedef struct
    
    /*DET code to report Invalid Pin*/
 #define PORT_E_PARAM_PIN                (uint8)0x25       
+   
+   /*DET code to report Invalid Port*/
+#define PORT_E_PARAM_INVALID_PORT       (uint8)0x26
+   
+   /*DET code to report a Mode not supported by the Pin*/
+#define PORT_E_MODE_NOT_SUPPORTED       (uint8)0x27
+   
+   /*DET code to report a register found different from its configured content by Port_MainFunction (repaired)*/
+#define PORT_E_REGISTER_DRIFT           (uint8)0x28
+   
+   /*DET code to report a level written to a Pin that is not an output*/
+#define PORT_E_PIN_NOT_OUTPUT           (uint8)0x29
+   
+   /*DET code to report a Level that is neither STD_HIGH nor STD_LOW*/
+#define PORT_E_PARAM_INVALID_LEVEL      (uint8)0x2A
 
 /*
  * API service used without module initialization is reported using following
@@ -201,7 +525,12 @@ typedef struct
 /*Initializes the Port Driver module*/
 void Port_Init( const Port_ConfigType* ConfigPtr );
 
-#if (Port_Set_Pin_Direction_Api == STD_ON)
+#if (PORT_EARLY_INIT_API == STD_ON)
+/*Port_EarlyInit shall put the critical pins in their configured state right after reset, before the C runtime initialization*/
+void Port_EarlyInit( const Port_ConfigType* ConfigPtr );
+#endif
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
 /*Sets the port pin direction*/
 void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction );
 #endif
@@ -217,12 +546,102 @@ void Port_GetVersionInfo( Std_VersionInfoType* versioninfo );
 /*Port_SetPinMode shall set the port pin mode of the referenced pin during runtime*/
 void Port_SetPinMode( Port_PinType Pin, Port_PinModeType Mode );
 
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+/*Port_SetPinDirections shall set the direction of a list of pins with one GPIODIR update per affected port*/
+void Port_SetPinDirections( const Port_PinType* Pins, uint8 Count, Port_PinDirectionType Direction );
+#endif
+
+/*Port_SetPinModes shall set the mode of a list of pins with one update of each mode register per affected port*/
+void Port_SetPinModes( const Port_PinType* Pins, uint8 Count, Port_PinModeType Mode );
+
+#if (PORT_WRITE_LEVEL_API == STD_ON)
+/*Port_WritePinLevel shall drive the level of one pin with a single masked GPIODATA store*/
+void Port_WritePinLevel( Port_PinType Pin, uint8 Level );
+
+/*Port_WritePortLevel shall drive the levels of any subset of the configured pins of a port with a single masked GPIODATA store*/
+void Port_WritePortLevel( uint8 Port_Num, uint8 Mask, uint8 Level );
+#endif
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+/*Port_CheckShadow shall compare the registers of every used port with their shadow and report the drifting ones*/
+Std_ReturnType Port_CheckShadow( uint8* Drift );
+#endif
+
+#if (PORT_MAIN_FUNCTION_API == STD_ON)
+/*Port_MainFunction shall refresh and verify PORT_MAIN_FUNCTION_REGISTERS registers per call, round-robin over the used ports*/
+void Port_MainFunction( void );
+
+/*Port_GetMainFunctionDrift shall report and clear the registers of every used port repaired by Port_MainFunction*/
+Std_ReturnType Port_GetMainFunctionDrift( uint8* Drift );
+#endif
+
+/*Port_SwitchConfig shall change the active configuration set from From to To writing only the registers that differ*/
+void Port_SwitchConfig( const Port_ConfigType* From, const Port_ConfigType* To );
+
+#if (PORT_VERIFY_CONFIG_API == STD_ON)
+/*Port_VerifyConfig shall compare the registers of every used port with the configuration and report the mismatching ones*/
+Std_ReturnType Port_VerifyConfig( uint8* Mismatch );
+#endif
+
+#if (PORT_DEBOUNCE_API == STD_ON)
+/*Port_DebounceTick shall sample every port with debounced pins once and advance all their counters together*/
+void Port_DebounceTick( void );
+
+/*Port_GetDebouncedLevel shall return the debounced level of one debounced pin*/
+uint8 Port_GetDebouncedLevel( Port_PinType Pin );
+
+/*Port_GetDebouncedPort shall return the debounced levels of the debounced pins of a port*/
+uint8 Port_GetDebouncedPort( uint8 Port_Num );
+#endif
+
+#if (PORT_SNAPSHOT_API == STD_ON)
+/*Port_Snapshot shall read the levels of the configured pins of every used port once into one 64-bit image*/
+uint64 Port_Snapshot( void );
+
+/*Port_GetEdges shall return the pins that rose and fell between the last two snapshots*/
+void Port_GetEdges( uint64* Rising, uint64* Falling );
+#endif
+
+#if (PORT_SLEEP_API == STD_ON)
+/*Port_SaveState shall copy the registers of every used port into a RAM context*/
+void Port_SaveState( Port_StateType* State );
+
+/*Port_RestoreState shall write back the registers of every used port from a RAM context saved by Port_SaveState*/
+void Port_RestoreState( const Port_StateType* State );
+
+/*Port_EnterSleep shall put the pins with a sleep attribute in their low power state*/
+void Port_EnterSleep( void );
+#endif
+
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+/*GPIO port interrupt vectors of cstartup_M.c, each one calls the notifications of the pending pins of its port*/
+void GPIOA_Handler( void );
+void GPIOB_Handler( void );
+void GPIOC_Handler( void );
+void GPIOD_Handler( void );
+void GPIOE_Handler( void );
+void GPIOF_Handler( void );
+#endif
+
+#if (PORT_STATISTICS_API == STD_ON)
+/*Port_GetStatistics shall copy the execution time statistics of every API*/
+void Port_GetStatistics( Port_StatisticsType* Statistics );
+#endif
+
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
 
 /* Extern PB structures to be used by Port and other modules */
 extern const Port_ConfigType Port_PinConfiguration;
+extern const Port_ConfigType Port_DiagnosticConfiguration;
+extern const Port_ConfigType Port_LowPowerConfiguration;
+
+/* Precomputed switches between the configuration sets, terminated by an entry with a NULL_PTR From */
+extern const Port_ConfigSwitchType Port_ConfigSwitches[];
+
+/* Notifications of the armed pins indexed by port and pin number, NULL_PTR for the pins without one */
+extern const Port_PinNotificationType Port_PinNotifications[PORT_NUMBER_OF_PORTS][PORT_PINS_PER_PORT];
 
 
 
@@ -33,10 +33,81 @@
 #define PORT_VERSION_INFO_API                           (STD_OFF)
 
 /* Pre-compile option for Pin Direction Info API */
-#define Port_SET_PIN_DIRECTION_API                      (STD_ON)  
+#define PORT_SET_PIN_DIRECTION_API                      (STD_ON)  
 
-/*NUmber of Pins in the MCU*/
+/* Pre-compile option for the pin and port level write APIs using the masked GPIODATA addresses */
+#define PORT_WRITE_LEVEL_API                            (STD_ON)
+
+/* Pre-compile option for single store pin updates through the peripheral bit-band alias */
+#define PORT_BIT_BAND_ACCESS                            (STD_ON)
+
+/* Pre-compile option for the RAM shadow of the runtime configurable registers, runtime updates are
+ * written from the shadow without reading the register back (takes precedence over PORT_BIT_BAND_ACCESS),
+ * overridable for tools/Port_Stress.c */
+#ifndef PORT_SHADOW_REGISTERS
+#define PORT_SHADOW_REGISTERS                           (STD_ON)
+#endif
+
+/* Pre-compile option for the interrupt safe updates of the reentrant APIs: exclusive load/store retry loops
+ * (LDREX/STREX) or single bit-band stores instead of plain read-modify-writes. Every update reads its register
+ * again (one more read than with the shadow alone). STD_OFF is only allowed when no pin API is called from
+ * an interrupt or a preempting task. Overridable for tools/Port_Stress.c */
+#ifndef PORT_LOCK_FREE_UPDATES
+#define PORT_LOCK_FREE_UPDATES                          (STD_ON)
+#endif
+
+/* Policies for the JTAG/SWD pins PC0 to PC3 */
+#define PORT_JTAG_PINS_PROTECTED                        (0U)    /* left untouched so the debugger stays connected */
+#define PORT_JTAG_PINS_CONFIGURABLE                     (1U)    /* unlocked, committed and configured like the other pins */
+
+/* Policy applied by tools/Port_Generator.py to the JTAG pins of the configuration */
+#define PORT_JTAG_PINS_POLICY                           PORT_JTAG_PINS_PROTECTED
+
+/* Pre-compile option for accessing the GPIO ports through the AHB aperture instead of the legacy APB one */
+#define PORT_AHB_APERTURE                               (STD_OFF)
+
+/* Pre-compile option for Port_EarlyInit, configuring the PORT_PIN_CRITICAL pins from cstartup_M.c before the C runtime initialization */
+#define PORT_EARLY_INIT_API                             (STD_ON)
+
+/* Pre-compile option for the GPIO pin interrupts: Port_Init programs the interrupt sense and arming of the
+ * pins with a PORT_PIN_IRQ_* attribute and the GPIOA to GPIOF vectors call their Port_PinNotifications */
+#define PORT_PIN_INTERRUPT_API                          (STD_ON)
+
+/* Pre-compile option for the input debouncing: Port_DebounceTick samples every port with PORT_PIN_DEBOUNCE_*
+ * pins once and runs their bit-sliced counters together, read back with Port_GetDebouncedLevel/Port */
+#define PORT_DEBOUNCE_API                               (STD_ON)
+
+/* Pre-compile option for Port_Snapshot and Port_GetEdges, change detection over all the configured pins */
+#define PORT_SNAPSHOT_API                               (STD_ON)
+
+/* Pre-compile option for the low power services: Port_SaveState/Port_RestoreState of the port registers and
+ * Port_EnterSleep writing the generated images of the pins with a PORT_PIN_SLEEP_* attribute */
+#define PORT_SLEEP_API                                  (STD_ON)
+
+/* Pre-compile option for the cyclic Port_MainFunction refreshing and verifying the port registers in the background */
+#define PORT_MAIN_FUNCTION_API                          (STD_ON)
+
+/* Registers checked by one Port_MainFunction call, 8 is one port per call with PORT_SHADOW_REGISTERS */
+#define PORT_MAIN_FUNCTION_REGISTERS                    (8U)
+
+/* Pre-compile option for Port_VerifyConfig, comparing the registers with the configuration images */
+#define PORT_VERIFY_CONFIG_API                          (STD_ON)
+
+/* Pre-compile option for Port_VerifyConfig writing back the configured content of the mismatching bits */
+#define PORT_VERIFY_REPAIR                              (STD_ON)
+
+/* Pre-compile option for the per API execution time statistics read out by Port_GetStatistics */
+#define PORT_STATISTICS_API                             (STD_OFF)
+
+/* Pre-compile option for building the driver on a host against the simulated registers of Port_Sim.c */
+#ifndef PORT_HOST_SIMULATION
+#define PORT_HOST_SIMULATION                            (STD_OFF)
+#endif
+
+/*NUmber of Pins in the MCU, overridable for the smaller configurations of tools/Port_Bench.py*/
+#ifndef PORT_CONFIGURED_PINS
 #define PORT_CONFIGURED_PINS                            (43U)
+#endif
 
 /*The First Pin*/
 #define PIN_MIN_NUMBER                                  (0U)
@@ -49,6 +120,12 @@
 #define PORT_PORTE                                      (4U) 
 #define PORT_PORTF                                      (5U)
 
+/*Number of GPIO Ports in the MCU*/
+#define PORT_NUMBER_OF_PORTS                            (6U)
+
+/*Number of pins of every GPIO port*/
+#define PORT_PINS_PER_PORT                              (8U)
+
 /*TM4C Pins*/
 #define PORT_PIN0                                       (0U)
 #define PORT_PIN1                                       (1U)
@@ -10,6 +10,7 @@
  ******************************************************************************/
 
 #include "Port.h"
+#include "Port_Regs.h"
 
 /*
  * Module Version 1.0.0
@@ -41,52 +42,554 @@
 
    /* PB structure used with Port_Init API */
 const Port_ConfigType Port_PinConfiguration = 
-   { PORT_PORTA , PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTA , PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTA , PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTA , PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTA , PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTA , PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTA , PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTA , PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
+{
+  {  PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
      
-     PORT_PORTB , PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTB , PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTB , PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTB , PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTB , PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTB , PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTB , PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTB , PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
      
-     PORT_PORTC , PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTC , PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTC , PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTC , PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTC , PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTC , PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTC , PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTC , PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
      
-     PORT_PORTD , PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTD , PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTD , PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTD , PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTD , PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTD , PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTD , PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTD , PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
      
-     PORT_PORTE , PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTE , PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTE , PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTE , PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTE , PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTE , PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
      
-     PORT_PORTF , PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTF , PORT_PIN1, PORT_PIN_OUT, Change, PORT_PIN_MODE_GPIO , Change , STD_OFF, PORT_PIN_OFF,
-     PORT_PORTF , PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTF , PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_OFF,
-     PORT_PORTF , PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO , Change , STD_ON, PORT_PIN_PUN };
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN1, PORT_PIN_OUT, Change, PORT_PIN_MODE_GPIO, Change, STD_OFF, PORT_PIN_OFF) | PORT_PIN_CRITICAL,
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PUN) },
+  
+/* Port_Generator begin: Port_PinConfiguration */
+  /* Generated by tools/Port_Generator.py - do not edit */
+  /* Port register images { Mask, Pctl_Mask, Commit, Amsel, Den, Afsel, Pctl, Dir, Dir_Locked, Data, Pur, Pdr, Mode_Locked, Pctl_Locked } */
+  {
+    { 0x000000FFU, 0xFFFFFFFFU, 0x00000000U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x000000FFU, 0xFFFFFFFFU, 0x00000000U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x000000F0U, 0xFFFF0000U, 0x00000000U, 0x00000000U, 0x000000F0U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x000000FFU, 0xFFFFFFFFU, 0x00000080U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x0000003FU, 0x00FFFFFFU, 0x00000000U, 0x00000000U, 0x0000003FU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x0000001FU, 0x000FFFFFU, 0x00000001U, 0x00000000U, 0x0000001FU, 0x00000000U, 0x00000000U, 0x00000002U, 0x00000000U, 0x00000000U, 0x00000010U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Pin register access data { Mask, Pctl_Shift } */
+  {
+    { 0x01U, 0U },  /* PA0 */
+    { 0x02U, 4U },  /* PA1 */
+    { 0x04U, 8U },  /* PA2 */
+    { 0x08U, 12U },  /* PA3 */
+    { 0x10U, 16U },  /* PA4 */
+    { 0x20U, 20U },  /* PA5 */
+    { 0x40U, 24U },  /* PA6 */
+    { 0x80U, 28U },  /* PA7 */
+    { 0x01U, 0U },  /* PB0 */
+    { 0x02U, 4U },  /* PB1 */
+    { 0x04U, 8U },  /* PB2 */
+    { 0x08U, 12U },  /* PB3 */
+    { 0x10U, 16U },  /* PB4 */
+    { 0x20U, 20U },  /* PB5 */
+    { 0x40U, 24U },  /* PB6 */
+    { 0x80U, 28U },  /* PB7 */
+    { 0x01U, 0U },  /* PC0 */
+    { 0x02U, 4U },  /* PC1 */
+    { 0x04U, 8U },  /* PC2 */
+    { 0x08U, 12U },  /* PC3 */
+    { 0x10U, 16U },  /* PC4 */
+    { 0x20U, 20U },  /* PC5 */
+    { 0x40U, 24U },  /* PC6 */
+    { 0x80U, 28U },  /* PC7 */
+    { 0x01U, 0U },  /* PD0 */
+    { 0x02U, 4U },  /* PD1 */
+    { 0x04U, 8U },  /* PD2 */
+    { 0x08U, 12U },  /* PD3 */
+    { 0x10U, 16U },  /* PD4 */
+    { 0x20U, 20U },  /* PD5 */
+    { 0x40U, 24U },  /* PD6 */
+    { 0x80U, 28U },  /* PD7 */
+    { 0x01U, 0U },  /* PE0 */
+    { 0x02U, 4U },  /* PE1 */
+    { 0x04U, 8U },  /* PE2 */
+    { 0x08U, 12U },  /* PE3 */
+    { 0x10U, 16U },  /* PE4 */
+    { 0x20U, 20U },  /* PE5 */
+    { 0x01U, 0U },  /* PF0 */
+    { 0x02U, 4U },  /* PF1 */
+    { 0x04U, 8U },  /* PF2 */
+    { 0x08U, 12U },  /* PF3 */
+    { 0x10U, 16U }   /* PF4 */
+  },
+  /* Port group addresses { Data_Address } */
+  {
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 0xFFU) },  /* PORTA */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 0xFFU) },  /* PORTB */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 0xF0U) },  /* PORTC */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 0xFFU) },  /* PORTD */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 0x3FU) },  /* PORTE */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 0x1FU) }   /* PORTF */
+  },
+  /* Clock_Mask */
+  0x0000003FU,
+  /* Critical pins of every port { PORTA, PORTB, PORTC, PORTD, PORTE, PORTF } */
+  { 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U },
+  /* Pin interrupt images { Im, Is, Ibe, Iev } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Debounce images { Mask, Reload0, Reload1, Reload2 } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Sleep images { Mask, Amsel, Afsel, Pur, Pdr, Data, Dir, Den, Data_Address } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 0x00U) },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 0x00U) },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 0x00U) },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 0x00U) },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 0x00U) },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 0x00U) }   /* PORTF */
+  }
+/* Port_Generator end: Port_PinConfiguration */
+};
 
+   /* PB structure of the diagnostic run mode: UART0 console on PA0/PA1 and the three LEDs of port F driven */
+const Port_ConfigType Port_DiagnosticConfiguration = 
+{
+  {  PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_ALT1, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_ALT1, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+   
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+   
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+   
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+   
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+   
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN1, PORT_PIN_OUT, Change, PORT_PIN_MODE_GPIO, Change, STD_OFF, PORT_PIN_OFF) | PORT_PIN_CRITICAL,
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN2, PORT_PIN_OUT, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN3, PORT_PIN_OUT, Change, PORT_PIN_MODE_GPIO, Change, STD_OFF, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PUN) },
+  
+/* Port_Generator begin: Port_DiagnosticConfiguration */
+  /* Generated by tools/Port_Generator.py - do not edit */
+  /* Port register images { Mask, Pctl_Mask, Commit, Amsel, Den, Afsel, Pctl, Dir, Dir_Locked, Data, Pur, Pdr, Mode_Locked, Pctl_Locked } */
+  {
+    { 0x000000FFU, 0xFFFFFFFFU, 0x00000000U, 0x00000000U, 0x000000FFU, 0x00000003U, 0x00000011U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x000000FFU, 0xFFFFFFFFU, 0x00000000U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x000000F0U, 0xFFFF0000U, 0x00000000U, 0x00000000U, 0x000000F0U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x000000FFU, 0xFFFFFFFFU, 0x00000080U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x0000003FU, 0x00FFFFFFU, 0x00000000U, 0x00000000U, 0x0000003FU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x0000001FU, 0x000FFFFFU, 0x00000001U, 0x00000000U, 0x0000001FU, 0x00000000U, 0x00000000U, 0x0000000EU, 0x00000000U, 0x00000004U, 0x00000010U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Pin register access data { Mask, Pctl_Shift } */
+  {
+    { 0x01U, 0U },  /* PA0 */
+    { 0x02U, 4U },  /* PA1 */
+    { 0x04U, 8U },  /* PA2 */
+    { 0x08U, 12U },  /* PA3 */
+    { 0x10U, 16U },  /* PA4 */
+    { 0x20U, 20U },  /* PA5 */
+    { 0x40U, 24U },  /* PA6 */
+    { 0x80U, 28U },  /* PA7 */
+    { 0x01U, 0U },  /* PB0 */
+    { 0x02U, 4U },  /* PB1 */
+    { 0x04U, 8U },  /* PB2 */
+    { 0x08U, 12U },  /* PB3 */
+    { 0x10U, 16U },  /* PB4 */
+    { 0x20U, 20U },  /* PB5 */
+    { 0x40U, 24U },  /* PB6 */
+    { 0x80U, 28U },  /* PB7 */
+    { 0x01U, 0U },  /* PC0 */
+    { 0x02U, 4U },  /* PC1 */
+    { 0x04U, 8U },  /* PC2 */
+    { 0x08U, 12U },  /* PC3 */
+    { 0x10U, 16U },  /* PC4 */
+    { 0x20U, 20U },  /* PC5 */
+    { 0x40U, 24U },  /* PC6 */
+    { 0x80U, 28U },  /* PC7 */
+    { 0x01U, 0U },  /* PD0 */
+    { 0x02U, 4U },  /* PD1 */
+    { 0x04U, 8U },  /* PD2 */
+    { 0x08U, 12U },  /* PD3 */
+    { 0x10U, 16U },  /* PD4 */
+    { 0x20U, 20U },  /* PD5 */
+    { 0x40U, 24U },  /* PD6 */
+    { 0x80U, 28U },  /* PD7 */
+    { 0x01U, 0U },  /* PE0 */
+    { 0x02U, 4U },  /* PE1 */
+    { 0x04U, 8U },  /* PE2 */
+    { 0x08U, 12U },  /* PE3 */
+    { 0x10U, 16U },  /* PE4 */
+    { 0x20U, 20U },  /* PE5 */
+    { 0x01U, 0U },  /* PF0 */
+    { 0x02U, 4U },  /* PF1 */
+    { 0x04U, 8U },  /* PF2 */
+    { 0x08U, 12U },  /* PF3 */
+    { 0x10U, 16U }   /* PF4 */
+  },
+  /* Port group addresses { Data_Address } */
+  {
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 0xFFU) },  /* PORTA */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 0xFFU) },  /* PORTB */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 0xF0U) },  /* PORTC */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 0xFFU) },  /* PORTD */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 0x3FU) },  /* PORTE */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 0x1FU) }   /* PORTF */
+  },
+  /* Clock_Mask */
+  0x0000003FU,
+  /* Critical pins of every port { PORTA, PORTB, PORTC, PORTD, PORTE, PORTF } */
+  { 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U },
+  /* Pin interrupt images { Im, Is, Ibe, Iev } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Debounce images { Mask, Reload0, Reload1, Reload2 } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Sleep images { Mask, Amsel, Afsel, Pur, Pdr, Data, Dir, Den, Data_Address } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 0x00U) },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 0x00U) },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 0x00U) },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 0x00U) },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 0x00U) },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 0x00U) }   /* PORTF */
+  }
+/* Port_Generator end: Port_DiagnosticConfiguration */
+};
+
+   /* PB structure of the low power run mode: every input pulled down except the PF0/PF4 wake-up switches, LED off */
+const Port_ConfigType Port_LowPowerConfiguration = 
+{
+  {  PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTA, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+   
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTB, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+   
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTC, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+   
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN6, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTD, PORT_PIN7, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+   
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN1, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN5, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+   
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PUN),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN1, PORT_PIN_OUT, Change, PORT_PIN_MODE_GPIO, Change, STD_OFF, PORT_PIN_OFF) | PORT_PIN_CRITICAL,
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN2, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN3, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_ON, PORT_PIN_PUN) },
+  
+/* Port_Generator begin: Port_LowPowerConfiguration */
+  /* Generated by tools/Port_Generator.py - do not edit */
+  /* Port register images { Mask, Pctl_Mask, Commit, Amsel, Den, Afsel, Pctl, Dir, Dir_Locked, Data, Pur, Pdr, Mode_Locked, Pctl_Locked } */
+  {
+    { 0x000000FFU, 0xFFFFFFFFU, 0x00000000U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x000000FFU, 0xFFFFFFFFU, 0x00000000U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x000000F0U, 0xFFFF0000U, 0x00000000U, 0x00000000U, 0x000000F0U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x000000F0U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x000000FFU, 0xFFFFFFFFU, 0x00000080U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x000000FFU, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x0000003FU, 0x00FFFFFFU, 0x00000000U, 0x00000000U, 0x0000003FU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x0000003FU, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x0000001FU, 0x000FFFFFU, 0x00000001U, 0x00000000U, 0x0000001FU, 0x00000000U, 0x00000000U, 0x00000002U, 0x00000000U, 0x00000000U, 0x00000011U, 0x0000000CU, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Pin register access data { Mask, Pctl_Shift } */
+  {
+    { 0x01U, 0U },  /* PA0 */
+    { 0x02U, 4U },  /* PA1 */
+    { 0x04U, 8U },  /* PA2 */
+    { 0x08U, 12U },  /* PA3 */
+    { 0x10U, 16U },  /* PA4 */
+    { 0x20U, 20U },  /* PA5 */
+    { 0x40U, 24U },  /* PA6 */
+    { 0x80U, 28U },  /* PA7 */
+    { 0x01U, 0U },  /* PB0 */
+    { 0x02U, 4U },  /* PB1 */
+    { 0x04U, 8U },  /* PB2 */
+    { 0x08U, 12U },  /* PB3 */
+    { 0x10U, 16U },  /* PB4 */
+    { 0x20U, 20U },  /* PB5 */
+    { 0x40U, 24U },  /* PB6 */
+    { 0x80U, 28U },  /* PB7 */
+    { 0x01U, 0U },  /* PC0 */
+    { 0x02U, 4U },  /* PC1 */
+    { 0x04U, 8U },  /* PC2 */
+    { 0x08U, 12U },  /* PC3 */
+    { 0x10U, 16U },  /* PC4 */
+    { 0x20U, 20U },  /* PC5 */
+    { 0x40U, 24U },  /* PC6 */
+    { 0x80U, 28U },  /* PC7 */
+    { 0x01U, 0U },  /* PD0 */
+    { 0x02U, 4U },  /* PD1 */
+    { 0x04U, 8U },  /* PD2 */
+    { 0x08U, 12U },  /* PD3 */
+    { 0x10U, 16U },  /* PD4 */
+    { 0x20U, 20U },  /* PD5 */
+    { 0x40U, 24U },  /* PD6 */
+    { 0x80U, 28U },  /* PD7 */
+    { 0x01U, 0U },  /* PE0 */
+    { 0x02U, 4U },  /* PE1 */
+    { 0x04U, 8U },  /* PE2 */
+    { 0x08U, 12U },  /* PE3 */
+    { 0x10U, 16U },  /* PE4 */
+    { 0x20U, 20U },  /* PE5 */
+    { 0x01U, 0U },  /* PF0 */
+    { 0x02U, 4U },  /* PF1 */
+    { 0x04U, 8U },  /* PF2 */
+    { 0x08U, 12U },  /* PF3 */
+    { 0x10U, 16U }   /* PF4 */
+  },
+  /* Port group addresses { Data_Address } */
+  {
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 0xFFU) },  /* PORTA */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 0xFFU) },  /* PORTB */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 0xF0U) },  /* PORTC */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 0xFFU) },  /* PORTD */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 0x3FU) },  /* PORTE */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 0x1FU) }   /* PORTF */
+  },
+  /* Clock_Mask */
+  0x0000003FU,
+  /* Critical pins of every port { PORTA, PORTB, PORTC, PORTD, PORTE, PORTF } */
+  { 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U },
+  /* Pin interrupt images { Im, Is, Ibe, Iev } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Debounce images { Mask, Reload0, Reload1, Reload2 } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Sleep images { Mask, Amsel, Afsel, Pur, Pdr, Data, Dir, Den, Data_Address } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 0x00U) },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 0x00U) },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 0x00U) },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 0x00U) },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 0x00U) },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 0x00U) }   /* PORTF */
+  }
+/* Port_Generator end: Port_LowPowerConfiguration */
+};
+
+/* Notifications of the pins armed with a PORT_PIN_IRQ_* attribute, called by the GPIO port vectors */
+const Port_PinNotificationType Port_PinNotifications[PORT_NUMBER_OF_PORTS][PORT_PINS_PER_PORT] =
+{
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR },  /* PORTA */
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR },  /* PORTB */
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR },  /* PORTC */
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR },  /* PORTD */
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR },  /* PORTE */
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR }   /* PORTF */
+};
+
+/* Port_Generator begin: Port_ConfigSwitches */
+  /* Generated by tools/Port_Generator.py - do not edit */
+/* Port_PinConfiguration -> Port_DiagnosticConfiguration { Mask, Value, Offset, Port_Num } */
+STATIC const Port_RegDeltaType Port_PinConfiguration_To_DiagnosticConfiguration[4] =
+{
+  { 0x00000003U, 0x00000003U, PORT_ALT_FUNC_REG_OFFSET, PORT_PORTA },
+  { 0x00000011U, 0x00000011U, PORT_CTL_REG_OFFSET, PORT_PORTA },
+  { 0xFFFFFFFFU, 0x00000004U, PORT_DATA_MASKED_ADDRESS(0U, 0x04U), PORT_PORTF },
+  { 0x0000000CU, 0x0000000CU, PORT_DIR_REG_OFFSET, PORT_PORTF }
+};
+
+/* Port_PinConfiguration -> Port_LowPowerConfiguration { Mask, Value, Offset, Port_Num } */
+STATIC const Port_RegDeltaType Port_PinConfiguration_To_LowPowerConfiguration[7] =
+{
+  { 0x000000FFU, 0x000000FFU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTA },
+  { 0x000000FFU, 0x000000FFU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTB },
+  { 0x000000F0U, 0x000000F0U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTC },
+  { 0x000000FFU, 0x000000FFU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTD },
+  { 0x0000003FU, 0x0000003FU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTE },
+  { 0x00000001U, 0x00000001U, PORT_PULL_UP_REG_OFFSET, PORT_PORTF },
+  { 0x0000000CU, 0x0000000CU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTF }
+};
+
+/* Port_DiagnosticConfiguration -> Port_PinConfiguration { Mask, Value, Offset, Port_Num } */
+STATIC const Port_RegDeltaType Port_DiagnosticConfiguration_To_PinConfiguration[3] =
+{
+  { 0x00000003U, 0x00000000U, PORT_ALT_FUNC_REG_OFFSET, PORT_PORTA },
+  { 0x00000011U, 0x00000000U, PORT_CTL_REG_OFFSET, PORT_PORTA },
+  { 0x0000000CU, 0x00000000U, PORT_DIR_REG_OFFSET, PORT_PORTF }
+};
+
+/* Port_DiagnosticConfiguration -> Port_LowPowerConfiguration { Mask, Value, Offset, Port_Num } */
+STATIC const Port_RegDeltaType Port_DiagnosticConfiguration_To_LowPowerConfiguration[10] =
+{
+  { 0x00000003U, 0x00000000U, PORT_ALT_FUNC_REG_OFFSET, PORT_PORTA },
+  { 0x00000011U, 0x00000000U, PORT_CTL_REG_OFFSET, PORT_PORTA },
+  { 0x000000FFU, 0x000000FFU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTA },
+  { 0x000000FFU, 0x000000FFU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTB },
+  { 0x000000F0U, 0x000000F0U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTC },
+  { 0x000000FFU, 0x000000FFU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTD },
+  { 0x0000003FU, 0x0000003FU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTE },
+  { 0x00000001U, 0x00000001U, PORT_PULL_UP_REG_OFFSET, PORT_PORTF },
+  { 0x0000000CU, 0x0000000CU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTF },
+  { 0x0000000CU, 0x00000000U, PORT_DIR_REG_OFFSET, PORT_PORTF }
+};
+
+/* Port_LowPowerConfiguration -> Port_PinConfiguration { Mask, Value, Offset, Port_Num } */
+STATIC const Port_RegDeltaType Port_LowPowerConfiguration_To_PinConfiguration[7] =
+{
+  { 0x000000FFU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTA },
+  { 0x000000FFU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTB },
+  { 0x000000F0U, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTC },
+  { 0x000000FFU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTD },
+  { 0x0000003FU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTE },
+  { 0x00000001U, 0x00000000U, PORT_PULL_UP_REG_OFFSET, PORT_PORTF },
+  { 0x0000000CU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTF }
+};
+
+/* Port_LowPowerConfiguration -> Port_DiagnosticConfiguration { Mask, Value, Offset, Port_Num } */
+STATIC const Port_RegDeltaType Port_LowPowerConfiguration_To_DiagnosticConfiguration[11] =
+{
+  { 0x00000003U, 0x00000003U, PORT_ALT_FUNC_REG_OFFSET, PORT_PORTA },
+  { 0x00000011U, 0x00000011U, PORT_CTL_REG_OFFSET, PORT_PORTA },
+  { 0x000000FFU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTA },
+  { 0x000000FFU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTB },
+  { 0x000000F0U, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTC },
+  { 0x000000FFU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTD },
+  { 0x0000003FU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTE },
+  { 0x00000001U, 0x00000000U, PORT_PULL_UP_REG_OFFSET, PORT_PORTF },
+  { 0x0000000CU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTF },
+  { 0xFFFFFFFFU, 0x00000004U, PORT_DATA_MASKED_ADDRESS(0U, 0x04U), PORT_PORTF },
+  { 0x0000000CU, 0x0000000CU, PORT_DIR_REG_OFFSET, PORT_PORTF }
+};
+
+/* Precomputed switches between the configuration sets { From, To, Delta, Count } */
+const Port_ConfigSwitchType Port_ConfigSwitches[7] =
+{
+  { &Port_PinConfiguration, &Port_DiagnosticConfiguration, Port_PinConfiguration_To_DiagnosticConfiguration, 4U },
+  { &Port_PinConfiguration, &Port_LowPowerConfiguration, Port_PinConfiguration_To_LowPowerConfiguration, 7U },
+  { &Port_DiagnosticConfiguration, &Port_PinConfiguration, Port_DiagnosticConfiguration_To_PinConfiguration, 3U },
+  { &Port_DiagnosticConfiguration, &Port_LowPowerConfiguration, Port_DiagnosticConfiguration_To_LowPowerConfiguration, 10U },
+  { &Port_LowPowerConfiguration, &Port_PinConfiguration, Port_LowPowerConfiguration_To_PinConfiguration, 7U },
+  { &Port_LowPowerConfiguration, &Port_DiagnosticConfiguration, Port_LowPowerConfiguration_To_DiagnosticConfiguration, 11U },
+  { NULL_PTR, NULL_PTR, NULL_PTR, 0U }
+};
+/* Port_Generator end: Port_ConfigSwitches */
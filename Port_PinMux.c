@@ -0,0 +1,79 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_PinMux.c
+ *
+ * Description: Pin multiplexing database of the TM4C123GH6PM, see Port_PinMux.h.
+ *
+ * Author: Ahmed Wael
+ ******************************************************************************/
+
+#include "Port_PinMux.h"
+
+const uint64 Port_PinMux[PORT_NUMBER_OF_PORTS][PORT_PINS_PER_PORT] =
+{
+/* Port_Generator begin: Port_PinMux */
+  /* Generated by tools/Port_Generator.py from tools/Port_PinMux.csv - do not edit */
+  {
+    0x0040180000000220ULL,  /* PA0 ALT1:U0Rx ALT8:CAN1Rx GPIO:GPIO */
+    0x0040180000000220ULL,  /* PA1 ALT1:U0Tx ALT8:CAN1Tx GPIO:GPIO */
+    0x0040000000004800ULL,  /* PA2 ALT2:SSI0Clk GPIO:GPIO */
+    0x0040000000004800ULL,  /* PA3 ALT2:SSI0Fss GPIO:GPIO */
+    0x0040000000004800ULL,  /* PA4 ALT2:SSI0Rx GPIO:GPIO */
+    0x0040000000004800ULL,  /* PA5 ALT2:SSI0Tx GPIO:GPIO */
+    0x004000002A098000ULL,  /* PA6 ALT3:I2C1SCL ALT5:M1PWM2 GPIO:GPIO */
+    0x004000002A098000ULL   /* PA7 ALT3:I2C1SDA ALT5:M1PWM3 GPIO:GPIO */
+  },
+  {
+    0x004000B800000220ULL,  /* PB0 ALT1:U1Rx ALT7:T2CCP0 GPIO:GPIO */
+    0x004000B800000220ULL,  /* PB1 ALT1:U1Tx ALT7:T2CCP1 GPIO:GPIO */
+    0x004000B800098000ULL,  /* PB2 ALT3:I2C0SCL ALT7:T3CCP0 GPIO:GPIO */
+    0x004000B800098000ULL,  /* PB3 ALT3:I2C0SDA ALT7:T3CCP1 GPIO:GPIO */
+    0x004018B801404810ULL,  /* PB4 ADC:AIN10 ALT2:SSI2Clk ALT4:M0PWM2 ALT7:T1CCP0 ALT8:CAN0Rx GPIO:GPIO */
+    0x004018B801404810ULL,  /* PB5 ADC:AIN11 ALT2:SSI2Fss ALT4:M0PWM3 ALT7:T1CCP1 ALT8:CAN0Tx GPIO:GPIO */
+    0x004000B801404800ULL,  /* PB6 ALT2:SSI2Rx ALT4:M0PWM0 ALT7:T0CCP0 GPIO:GPIO */
+    0x004000B801404800ULL   /* PB7 ALT2:SSI2Tx ALT4:M0PWM1 ALT7:T0CCP1 GPIO:GPIO */
+  },
+  {
+    0x004000B800000220ULL,  /* PC0 ALT1:TCK/SWCLK ALT7:T4CCP0 GPIO:GPIO */
+    0x004000B800000220ULL,  /* PC1 ALT1:TMS/SWDIO ALT7:T4CCP1 GPIO:GPIO */
+    0x004000B800000220ULL,  /* PC2 ALT1:TDI ALT7:T5CCP0 GPIO:GPIO */
+    0x004000B800000220ULL,  /* PC3 ALT1:TDO/SWO ALT7:T5CCP1 GPIO:GPIO */
+    0x004018BD81404A20ULL,  /* PC4 ALT1:U4Rx ALT2:U1Rx ALT4:M0PWM6 ALT6:IDX1 ALT7:WT0CCP0 ALT8:U1RTS GPIO:GPIO */
+    0x004018BD81404A20ULL,  /* PC5 ALT1:U4Tx ALT2:U1Tx ALT4:M0PWM7 ALT6:PhA1 ALT7:WT0CCP1 ALT8:U1CTS GPIO:GPIO */
+    0x004018BD80000220ULL,  /* PC6 ALT1:U3Rx ALT6:PhB1 ALT7:WT1CCP0 ALT8:USB0EPEN GPIO:GPIO */
+    0x004018B800000220ULL   /* PC7 ALT1:U3Tx ALT7:WT1CCP1 ALT8:USB0PFLT GPIO:GPIO */
+  },
+  {
+    0x004000B82B49CA30ULL,  /* PD0 ADC:AIN7 ALT1:SSI3Clk ALT2:SSI1Clk ALT3:I2C3SCL ALT4:M0PWM6 ALT5:M1PWM0 ALT7:WT2CCP0 GPIO:GPIO */
+    0x004000B82B49CA30ULL,  /* PD1 ADC:AIN6 ALT1:SSI3Fss ALT2:SSI1Fss ALT3:I2C3SDA ALT4:M0PWM7 ALT5:M1PWM1 ALT7:WT2CCP1 GPIO:GPIO */
+    0x004018B801404A30ULL,  /* PD2 ADC:AIN5 ALT1:SSI3Rx ALT2:SSI1Rx ALT4:M0FAULT0 ALT7:WT3CCP0 ALT8:USB0EPEN GPIO:GPIO */
+    0x004018BD80004A30ULL,  /* PD3 ADC:AIN4 ALT1:SSI3Tx ALT2:SSI1Tx ALT6:IDX0 ALT7:WT3CCP1 ALT8:USB0PFLT GPIO:GPIO */
+    0x004000B800000220ULL,  /* PD4 ALT1:U6Rx ALT7:WT4CCP0 GPIO:GPIO */
+    0x004000B800000220ULL,  /* PD5 ALT1:U6Tx ALT7:WT4CCP1 GPIO:GPIO */
+    0x004000BD81400220ULL,  /* PD6 ALT1:U2Rx ALT4:M0FAULT0 ALT6:PhA0 ALT7:WT5CCP0 GPIO:GPIO */
+    0x004018BD80000220ULL   /* PD7 ALT1:U2Tx ALT6:PhB0 ALT7:WT5CCP1 ALT8:NMI GPIO:GPIO */
+  },
+  {
+    0x0040000000000230ULL,  /* PE0 ADC:AIN3 ALT1:U7Rx GPIO:GPIO */
+    0x0040000000000230ULL,  /* PE1 ADC:AIN2 ALT1:U7Tx GPIO:GPIO */
+    0x0040000000000010ULL,  /* PE2 ADC:AIN1 GPIO:GPIO */
+    0x0040000000000010ULL,  /* PE3 ADC:AIN0 GPIO:GPIO */
+    0x004018002B498230ULL,  /* PE4 ADC:AIN9 ALT1:U5Rx ALT3:I2C2SCL ALT4:M0PWM4 ALT5:M1PWM2 ALT8:CAN0Rx GPIO:GPIO */
+    0x004018002B498230ULL,  /* PE5 ADC:AIN8 ALT1:U5Tx ALT3:I2C2SDA ALT4:M0PWM5 ALT5:M1PWM3 ALT8:CAN0Tx GPIO:GPIO */
+    0x0000000000000000ULL,  /* PE6 not bonded */
+    0x0000000000000000ULL   /* PE7 not bonded */
+  },
+  {
+    0x004338BDAA09CA20ULL,  /* PF0 ALT1:U1RTS ALT2:SSI1Rx ALT3:CAN0Rx ALT5:M1PWM4 ALT6:PhA0 ALT7:T0CCP0 ALT8:NMI ALT9:C0o GPIO:GPIO */
+    0x004320B82A004A20ULL,  /* PF1 ALT1:U1CTS ALT2:SSI1Tx ALT5:M1PWM5 ALT7:T0CCP1 ALT9:C1o GPIO:GPIO */
+    0x004000B82B404800ULL,  /* PF2 ALT2:SSI1Clk ALT4:M0FAULT0 ALT5:M1PWM6 ALT7:T1CCP0 GPIO:GPIO */
+    0x004000B82A09C800ULL,  /* PF3 ALT2:SSI1Fss ALT3:CAN0Tx ALT5:M1PWM7 ALT7:T1CCP1 GPIO:GPIO */
+    0x004018BDAA000000ULL,  /* PF4 ALT5:M1FAULT0 ALT6:IDX0 ALT7:T2CCP0 ALT8:USB0EPEN GPIO:GPIO */
+    0x0000000000000000ULL,  /* PF5 not bonded */
+    0x0000000000000000ULL,  /* PF6 not bonded */
+    0x0000000000000000ULL   /* PF7 not bonded */
+  }
+/* Port_Generator end: Port_PinMux */
+};
@@ -0,0 +1,33 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_PinMux.h
+ *
+ * Description: Pin multiplexing database of the TM4C123GH6PM used by the Port Driver.
+ *              Every physical pin has one 64-bit word holding a 5-bit entry per
+ *              Port_PinModeType: bit 4 is set when the pin supports the mode and
+ *              bits 3..0 hold the PMCx value written to GPIOPCTL for it.
+ *
+ * Author: Ahmed Wael
+ ******************************************************************************/
+
+#ifndef PORT_PINMUX_H
+#define PORT_PINMUX_H
+
+#include "Std_Types.h"
+#include "Port_Cfg.h"
+
+/* Layout of the entry of one mode */
+#define PORT_PINMUX_ENTRY_BITS            (5U)
+#define PORT_PINMUX_VALID                 (0x10U)
+#define PORT_PINMUX_PCTL_MASK             (0x0FU)
+
+/* Entry of MODE for pin PIN_NUM of port PORT_NUM, MODE must not exceed PORT_PIN_MODE_GPIO */
+#define PORT_PINMUX_ENTRY(PORT_NUM,PIN_NUM,MODE) \
+  ((uint8)((Port_PinMux[PORT_NUM][PIN_NUM] >> ((uint32)(MODE) * PORT_PINMUX_ENTRY_BITS)) & (PORT_PINMUX_VALID | PORT_PINMUX_PCTL_MASK)))
+
+/* Generated from tools/Port_PinMux.csv by tools/Port_Generator.py, pins missing on a port support no mode */
+extern const uint64 Port_PinMux[PORT_NUMBER_OF_PORTS][PORT_PINS_PER_PORT];
+
+#endif /* PORT_PINMUX_H */
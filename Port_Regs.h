@@ -14,22 +14,58 @@
 
 #include "Std_Types.h"
 
+/* Pre-compile options selecting the register access backend */
+#include "Port_Cfg.h"
+
 /*******************************************************************************
  *                              Module Definitions                             *
  *******************************************************************************/
 
-/* GPIO Registers base addresses */
-#define GPIO_PORTA_BASE_ADDRESS           0x40004000
-#define GPIO_PORTB_BASE_ADDRESS           0x40005000
-#define GPIO_PORTC_BASE_ADDRESS           0x40006000
-#define GPIO_PORTD_BASE_ADDRESS           0x40007000
-#define GPIO_PORTE_BASE_ADDRESS           0x40024000
-#define GPIO_PORTF_BASE_ADDRESS           0x40025000
+/* GPIO Registers base addresses on the legacy APB aperture */
+#define GPIO_PORTA_APB_BASE_ADDRESS       0x40004000
+#define GPIO_PORTB_APB_BASE_ADDRESS       0x40005000
+#define GPIO_PORTC_APB_BASE_ADDRESS       0x40006000
+#define GPIO_PORTD_APB_BASE_ADDRESS       0x40007000
+#define GPIO_PORTE_APB_BASE_ADDRESS       0x40024000
+#define GPIO_PORTF_APB_BASE_ADDRESS       0x40025000
+
+/* GPIO Registers base addresses on the AHB aperture */
+#define GPIO_PORTA_AHB_BASE_ADDRESS       0x40058000
+#define GPIO_PORTB_AHB_BASE_ADDRESS       0x40059000
+#define GPIO_PORTC_AHB_BASE_ADDRESS       0x4005A000
+#define GPIO_PORTD_AHB_BASE_ADDRESS       0x4005B000
+#define GPIO_PORTE_AHB_BASE_ADDRESS       0x4005C000
+#define GPIO_PORTF_AHB_BASE_ADDRESS       0x4005D000
+
+/* GPIO Registers base addresses used by the driver */
+#if (PORT_AHB_APERTURE == STD_ON)
+#define GPIO_PORTA_BASE_ADDRESS           GPIO_PORTA_AHB_BASE_ADDRESS
+#define GPIO_PORTB_BASE_ADDRESS           GPIO_PORTB_AHB_BASE_ADDRESS
+#define GPIO_PORTC_BASE_ADDRESS           GPIO_PORTC_AHB_BASE_ADDRESS
+#define GPIO_PORTD_BASE_ADDRESS           GPIO_PORTD_AHB_BASE_ADDRESS
+#define GPIO_PORTE_BASE_ADDRESS           GPIO_PORTE_AHB_BASE_ADDRESS
+#define GPIO_PORTF_BASE_ADDRESS           GPIO_PORTF_AHB_BASE_ADDRESS
+#else
+#define GPIO_PORTA_BASE_ADDRESS           GPIO_PORTA_APB_BASE_ADDRESS
+#define GPIO_PORTB_BASE_ADDRESS           GPIO_PORTB_APB_BASE_ADDRESS
+#define GPIO_PORTC_BASE_ADDRESS           GPIO_PORTC_APB_BASE_ADDRESS
+#define GPIO_PORTD_BASE_ADDRESS           GPIO_PORTD_APB_BASE_ADDRESS
+#define GPIO_PORTE_BASE_ADDRESS           GPIO_PORTE_APB_BASE_ADDRESS
+#define GPIO_PORTF_BASE_ADDRESS           GPIO_PORTF_APB_BASE_ADDRESS
+#endif
 
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
 #define PORT_DIR_REG_OFFSET               0x400
+#define PORT_INT_SENSE_REG_OFFSET         0x404
+#define PORT_INT_BOTH_EDGES_REG_OFFSET    0x408
+#define PORT_INT_EVENT_REG_OFFSET         0x40C
+#define PORT_INT_MASK_REG_OFFSET          0x410
+#define PORT_RAW_INT_STATUS_REG_OFFSET    0x414
+#define PORT_MASKED_INT_STATUS_REG_OFFSET 0x418
+#define PORT_INT_CLEAR_REG_OFFSET         0x41C
 #define PORT_ALT_FUNC_REG_OFFSET          0x420
+#define PORT_OPEN_DRAIN_REG_OFFSET        0x50C
 #define PORT_PULL_UP_REG_OFFSET           0x510
 #define PORT_PULL_DOWN_REG_OFFSET         0x514
 #define PORT_DIGITAL_ENABLE_REG_OFFSET    0x51C
@@ -37,9 +73,123 @@
 #define PORT_COMMIT_REG_OFFSET            0x524
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
+
+/* Value written to GPIOLOCK to unlock the GPIOCR register */
+#define PORT_LOCK_KEY                     0x4C4F434B
    
-/* RCC Registers */
-#define SYSCTL_REGCGC2_REG        		(*((volatile uint32 *)0x400FE108))
+/* GPIODATA address that accesses only the pins of MASK, address bits [9:2] select the pins */
+#define PORT_DATA_MASKED_ADDRESS(BASE,MASK)   ((uint32)(BASE) + ((uint32)(MASK) << 2))
+
+/* GPIO Run Mode Clock Gating Control register address, bit n clocks port n */
+#define SYSCTL_RCGCGPIO_REG_ADDRESS       0x400FE608
+
+/* GPIO Peripheral Ready register address, bit n is set once port n can be accessed */
+#define SYSCTL_PRGPIO_REG_ADDRESS         0x400FEA08
+
+/* GPIO High-Performance Bus Control register address, bit n moves port n to the AHB aperture */
+#define SYSCTL_GPIOHBCTL_REG_ADDRESS      0x400FE06C
+
+/* Peripheral bit-band region and its alias, one alias word per register bit */
+#define PORT_BIT_BAND_PERIPH_BASE         0x40000000U
+#define PORT_BIT_BAND_ALIAS_BASE          0x42000000U
+#define PORT_BIT_BAND_ALIAS(ADDRESS,BIT)  (PORT_BIT_BAND_ALIAS_BASE + (((uint32)(ADDRESS) - PORT_BIT_BAND_PERIPH_BASE) * 32U) + ((uint32)(BIT) * 4U))
+
+/* NVIC Interrupt Set Enable register of the interrupts 0 to 31, a 1 enables, a 0 has no effect */
+#define NVIC_EN0_REG_ADDRESS              0xE000E100
+
+/* Core debug registers of the DWT cycle counter used by PORT_STATISTICS_API */
+#define CORE_DEMCR_REG_ADDRESS            0xE000EDFC
+#define CORE_DEMCR_TRCENA_BIT             24
+#define CORE_DWT_CTRL_REG_ADDRESS         0xE0001000
+#define CORE_DWT_CTRL_CYCCNTENA_BIT       0
+#define CORE_DWT_CYCCNT_REG_ADDRESS       0xE0001004
+
+/*******************************************************************************
+ *                           Register Access                                   *
+ *******************************************************************************/
+
+#if (PORT_HOST_SIMULATION == STD_ON)
+
+/* Registers are simulated on the host and every access is counted */
+#include "Port_Sim.h"
+#define PORT_READ_REG(ADDRESS)            Port_Sim_Read((uint32)(ADDRESS))
+#define PORT_WRITE_REG(ADDRESS,VALUE)     Port_Sim_Write((uint32)(ADDRESS), (uint32)(VALUE))
+
+/* The accesses between the two hooks are attributed to the API with service Id SID */
+#define PORT_SIM_API_ENTER(SID)           Port_Sim_ApiEnter((uint8)(SID))
+#define PORT_SIM_API_EXIT(SID)            Port_Sim_ApiExit((uint8)(SID))
+
+/* No cycle counter on the host, time stamps come from the monotonic clock in nanoseconds */
+#define PORT_TIMESTAMP_ENABLE()
+#define PORT_TIMESTAMP()                  Port_Sim_GetTime()
+
+/* Exclusive load/store of a register and of a RAM word, the store returns 0 if the word was not updated since the load */
+#define PORT_LOAD_EXCLUSIVE_REG(ADDRESS)          Port_Sim_LoadExclusive((uint32)(ADDRESS))
+#define PORT_STORE_EXCLUSIVE_REG(ADDRESS,VALUE)   Port_Sim_StoreExclusive((uint32)(ADDRESS), (uint32)(VALUE))
+#define PORT_LOAD_EXCLUSIVE(WORD)                 Port_Sim_LoadExclusiveWord(WORD)
+#define PORT_STORE_EXCLUSIVE(WORD,VALUE)          Port_Sim_StoreExclusiveWord((WORD), (uint32)(VALUE))
+
+/* CLZ instruction through the compiler builtin, the word must not be 0 */
+#define PORT_CLZ(VALUE)                   ((uint8)__builtin_clz((unsigned int)(VALUE)))
+
+/* Interrupts are threads on the host, masking them serializes the critical sections */
+#define PORT_ENTER_CRITICAL()             Port_Sim_EnterCritical()
+#define PORT_EXIT_CRITICAL()              Port_Sim_ExitCritical()
+
+#else
+
+#define PORT_READ_REG(ADDRESS)            (*(volatile uint32 *)(ADDRESS))
+#define PORT_WRITE_REG(ADDRESS,VALUE)     (*(volatile uint32 *)(ADDRESS) = (uint32)(VALUE))
+
+#define PORT_SIM_API_ENTER(SID)
+#define PORT_SIM_API_EXIT(SID)
+
+/* Time stamps are DWT cycles, the counter is started once by Port_Init */
+#define PORT_TIMESTAMP_ENABLE()           do { (*(volatile uint32 *)CORE_DEMCR_REG_ADDRESS) |= ((uint32)1 << CORE_DEMCR_TRCENA_BIT); \
+                                               (*(volatile uint32 *)CORE_DWT_CTRL_REG_ADDRESS) |= ((uint32)1 << CORE_DWT_CTRL_CYCCNTENA_BIT); } while(0)
+#define PORT_TIMESTAMP()                  (*(volatile uint32 *)CORE_DWT_CYCCNT_REG_ADDRESS)
+
+/* CLZ, LDREX, STREX and interrupt state intrinsics of the IAR compiler */
+#include <intrinsics.h>
+
+/* Number of leading zero bits of a non zero word */
+#define PORT_CLZ(VALUE)                   ((uint8)__CLZ((unsigned long)(VALUE)))
+
+/* Interrupts masked with PRIMASK around a short section, the previous PRIMASK is restored so sections may nest,
+ * both macros must be used in the same block */
+#define PORT_ENTER_CRITICAL()             __istate_t Port_Interrupt_State = __get_interrupt_state(); __disable_interrupt()
+#define PORT_EXIT_CRITICAL()              __set_interrupt_state(Port_Interrupt_State)
+
+/* The local monitor is cleared on every exception entry and return, an interrupt between the load
+ * and the store makes the store fail */
+#define PORT_LOAD_EXCLUSIVE_REG(ADDRESS)          ((uint32)__LDREX((unsigned long *)(ADDRESS)))
+#define PORT_STORE_EXCLUSIVE_REG(ADDRESS,VALUE)   ((uint32)__STREX((unsigned long)(VALUE), (unsigned long *)(ADDRESS)))
+#define PORT_LOAD_EXCLUSIVE(WORD)                 ((uint32)__LDREX((unsigned long *)(WORD)))
+#define PORT_STORE_EXCLUSIVE(WORD,VALUE)          ((uint32)__STREX((unsigned long)(VALUE), (unsigned long *)(WORD)))
+
+#endif
+
+/* Read-modify-write helpers built on the register access macros */
+#define PORT_SET_REG_BITS(ADDRESS,MASK)           PORT_WRITE_REG((ADDRESS), PORT_READ_REG(ADDRESS) | (uint32)(MASK))
+#define PORT_CLEAR_REG_BITS(ADDRESS,MASK)         PORT_WRITE_REG((ADDRESS), PORT_READ_REG(ADDRESS) & ~(uint32)(MASK))
+#define PORT_WRITE_REG_MASKED(ADDRESS,MASK,VALUE) PORT_WRITE_REG((ADDRESS), (PORT_READ_REG(ADDRESS) & ~(uint32)(MASK)) | ((uint32)(VALUE) & (uint32)(MASK)))
+
+/* Lock free updates of the MASK bits of a register and of a RAM word: the read-modify-write is retried until
+ * its exclusive store succeeds, an interrupt updating the same word in between is never overwritten */
+#define PORT_ATOMIC_WRITE_REG_MASKED(ADDRESS,MASK,VALUE) \
+  do { uint32 Port_Exclusive_Value; \
+       do { Port_Exclusive_Value = (PORT_LOAD_EXCLUSIVE_REG(ADDRESS) & ~(uint32)(MASK)) | ((uint32)(VALUE) & (uint32)(MASK)); } \
+       while(PORT_STORE_EXCLUSIVE_REG((ADDRESS), Port_Exclusive_Value) != 0U); } while(0)
+#define PORT_ATOMIC_WRITE_WORD_MASKED(WORD,MASK,VALUE) \
+  do { uint32 Port_Exclusive_Value; \
+       do { Port_Exclusive_Value = (PORT_LOAD_EXCLUSIVE(WORD) & ~(uint32)(MASK)) | ((uint32)(VALUE) & (uint32)(MASK)); } \
+       while(PORT_STORE_EXCLUSIVE((WORD), Port_Exclusive_Value) != 0U); } while(0)
+
+/* Lock free addition of VALUE to a RAM word, retried like the masked writes */
+#define PORT_ATOMIC_ADD_WORD(WORD,VALUE) \
+  do { uint32 Port_Exclusive_Value; \
+       do { Port_Exclusive_Value = PORT_LOAD_EXCLUSIVE(WORD) + (uint32)(VALUE); } \
+       while(PORT_STORE_EXCLUSIVE((WORD), Port_Exclusive_Value) != 0U); } while(0)
 
 
 #endif  /*PORT_REGS_H*/
\ No newline at end of file
@@ -0,0 +1,622 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Sim.c
+ *
+ * Description: Host simulation of the TM4C123GH6PM GPIO ports A to F and of the
+ *              System Control registers used by the Port Driver. Port.c is built
+ *              against it when PORT_HOST_SIMULATION is STD_ON so the register
+ *              traffic of every API can be counted without a board.
+ *
+ *              Modeled behavior:
+ *              -Bit-band alias and masked GPIODATA addresses
+ *              -GPIOLOCK/GPIOCR: GPIOCR only writable while unlocked, GPIOAFSEL,
+ *               GPIOPUR, GPIOPDR and GPIODEN bits of uncommitted pins ignore writes
+ *              -Clock gating (RCGCGPIO/PRGPIO) and aperture selection (GPIOHBCTL)
+ *              -Reset values of the JTAG pins PC0 to PC3
+ *              -LDREX/STREX: one exclusive monitor per host thread, a store is
+ *               atomic and an alias store is an atomic read-modify-write, so
+ *               tools/Port_Stress.c can run the driver from several threads
+ *              -Pin interrupts: GPIORIS latched from the pad levels injected with
+ *               Port_Sim_SetPinLevel, GPIOMIS, write-1-to-clear GPIOICR and the
+ *               NVIC EN0 bits of the GPIO vectors, called synchronously
+ *
+ * Author: Ahmed Wael
+ ******************************************************************************/
+
+/* clock_gettime() and CLOCK_MONOTONIC in strict C99 builds */
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+#include <sched.h>
+
+#include "Port.h"
+#include "Port_Regs.h"
+
+#if (PORT_HOST_SIMULATION == STD_ON)
+
+/* Size of the register window of one GPIO port in words */
+#define PORT_SIM_PORT_WORDS               (0x1000U / 4U)
+
+/* Word index of a register in the window of its port */
+#define PORT_SIM_WORD(OFFSET)             ((uint32)(OFFSET) / 4U)
+
+/* End of the peripheral bit-band alias region */
+#define PORT_SIM_BIT_BAND_ALIAS_END       0x44000000U
+
+/* Simulated System Control registers */
+#define PORT_SIM_SYSCTL_RCGCGPIO          (0U)
+#define PORT_SIM_SYSCTL_GPIOHBCTL         (1U)
+#define PORT_SIM_NVIC_EN0                 (2U)
+#define PORT_SIM_SYSCTL_REGS              (3U)
+
+STATIC const uint32 Port_Sim_ApbBase[PORT_NUMBER_OF_PORTS] =
+{
+  GPIO_PORTA_APB_BASE_ADDRESS,
+  GPIO_PORTB_APB_BASE_ADDRESS,
+  GPIO_PORTC_APB_BASE_ADDRESS,
+  GPIO_PORTD_APB_BASE_ADDRESS,
+  GPIO_PORTE_APB_BASE_ADDRESS,
+  GPIO_PORTF_APB_BASE_ADDRESS,
+};
+
+STATIC const uint32 Port_Sim_AhbBase[PORT_NUMBER_OF_PORTS] =
+{
+  GPIO_PORTA_AHB_BASE_ADDRESS,
+  GPIO_PORTB_AHB_BASE_ADDRESS,
+  GPIO_PORTC_AHB_BASE_ADDRESS,
+  GPIO_PORTD_AHB_BASE_ADDRESS,
+  GPIO_PORTE_AHB_BASE_ADDRESS,
+  GPIO_PORTF_AHB_BASE_ADDRESS,
+};
+
+/* Pins that need their GPIOCR bit set before GPIOAFSEL, GPIOPUR, GPIOPDR and GPIODEN accept writes */
+STATIC const uint8 Port_Sim_LockedPins[PORT_NUMBER_OF_PORTS] = { 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01 };
+
+STATIC uint32 Port_Sim_PortRegs[PORT_NUMBER_OF_PORTS][PORT_SIM_PORT_WORDS];
+STATIC boolean Port_Sim_Unlocked[PORT_NUMBER_OF_PORTS];
+STATIC uint32 Port_Sim_SysCtlRegs[PORT_SIM_SYSCTL_REGS];
+
+/* Levels applied to the pads by Port_Sim_SetPinLevel */
+STATIC uint8 Port_Sim_PadLevels[PORT_NUMBER_OF_PORTS];
+
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+/* NVIC interrupt numbers and vectors of the GPIO ports A to F */
+STATIC const uint8 Port_Sim_IrqNumber[PORT_NUMBER_OF_PORTS] = { 0U, 1U, 2U, 3U, 4U, 30U };
+STATIC void (* const Port_Sim_Vector[PORT_NUMBER_OF_PORTS])( void ) =
+{
+  GPIOA_Handler,
+  GPIOB_Handler,
+  GPIOC_Handler,
+  GPIOD_Handler,
+  GPIOE_Handler,
+  GPIOF_Handler,
+};
+#endif
+
+STATIC Port_Sim_CountersType Port_Sim_Counters;
+STATIC Port_Sim_CountersType Port_Sim_ApiCounters[PORT_SIM_API_SLOTS];
+STATIC Port_Sim_CountersType Port_Sim_PortRegCounters[PORT_NUMBER_OF_PORTS][PORT_SIM_PORT_WORDS];
+STATIC Port_Sim_CountersType Port_Sim_SysCtlCounters[PORT_SIM_SYSCTL_REGS];
+STATIC __thread uint8 Port_Sim_CurrentApi = PORT_SIM_NO_API;
+
+/* Exclusive monitor of the calling thread: word loaded by the last exclusive load and its value, NULL_PTR when clear.
+ * The store compares the value, an update restoring the same value in between is not seen (harmless for bit fields) */
+STATIC __thread uint32 * Port_Sim_MonitorWord = NULL_PTR;
+STATIC __thread uint32 Port_Sim_MonitorValue;
+
+/* Every Port_Sim_PreemptPeriod-th access of a thread first yields the host CPU, 0 never yields */
+STATIC uint32 Port_Sim_PreemptPeriod = 0;
+STATIC __thread uint32 Port_Sim_PreemptCount = 0;
+
+/* Held by the thread that masked the simulated interrupts, with its nesting depth */
+STATIC boolean Port_Sim_CriticalLock = FALSE;
+STATIC __thread uint32 Port_Sim_CriticalDepth = 0;
+
+/* Counters are shared by the threads of tools/Port_Stress.c */
+#define PORT_SIM_COUNT(COUNTER,N)         ((void)__atomic_fetch_add(&(COUNTER), (uint32)(N), __ATOMIC_RELAXED))
+
+/* A decoded bus access */
+typedef struct
+{
+  uint32 * Reg;                     /* Simulated register, NULL_PTR if unmapped */
+  Port_Sim_CountersType * Counters; /* Counters of that register */
+  uint32 Data_Mask;                 /* Bits reached by the access */
+  uint32 Cycles;                    /* Modeled cost of the access */
+  uint8 Port_Num;                   /* Port of the register, PORT_NUMBER_OF_PORTS for System Control */
+  uint32 Offset;                    /* Offset of the register in its port */
+  boolean Alias;                    /* Access through the bit-band alias */
+  
+}Port_Sim_AccessType;
+
+STATIC void Port_Sim_Decode( uint32 Address, Port_Sim_AccessType * Access )
+{
+  Access->Reg = NULL_PTR;
+  Access->Counters = NULL_PTR;
+  Access->Data_Mask = 0xFFFFFFFFU;
+  Access->Cycles = PORT_SIM_APB_ACCESS_CYCLES;
+  Access->Port_Num = PORT_NUMBER_OF_PORTS;
+  Access->Offset = 0;
+  Access->Alias = FALSE;
+  
+  if((Address >= PORT_BIT_BAND_ALIAS_BASE) && (Address < PORT_SIM_BIT_BAND_ALIAS_END))
+  {
+    uint32 Alias_Offset = Address - PORT_BIT_BAND_ALIAS_BASE;
+    uint32 Byte_Address = PORT_BIT_BAND_PERIPH_BASE + (Alias_Offset / 32U);
+    
+    Port_Sim_Decode(Byte_Address & ~3U, Access);
+    Access->Data_Mask &= (uint32)1 << (((Byte_Address & 3U) * 8U) + ((Alias_Offset / 4U) & 7U));
+    Access->Alias = TRUE;
+    return;
+  }
+  
+  for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+  {
+    uint32 Base;
+    boolean Ahb = FALSE;
+    
+    if((Address >= Port_Sim_AhbBase[Port_Num]) && (Address < (Port_Sim_AhbBase[Port_Num] + 0x1000U)))
+    {
+      Base = Port_Sim_AhbBase[Port_Num];
+      Ahb = TRUE;
+    }
+    else if((Address >= Port_Sim_ApbBase[Port_Num]) && (Address < (Port_Sim_ApbBase[Port_Num] + 0x1000U)))
+    {
+      Base = Port_Sim_ApbBase[Port_Num];
+    }
+    else
+    {
+      continue;
+    }
+    
+    Access->Port_Num = Port_Num;
+    Access->Offset = Address - Base;
+    Access->Cycles = Ahb ? PORT_SIM_AHB_ACCESS_CYCLES : PORT_SIM_APB_ACCESS_CYCLES;
+    
+    if(Access->Offset <= PORT_DATA_REG_OFFSET)
+    {
+      /* Address bits [9:2] select the GPIODATA bits that are accessed */
+      Access->Data_Mask = (Access->Offset >> 2) & 0xFFU;
+      Access->Offset = PORT_DATA_REG_OFFSET;
+    }
+    
+    if( (BIT_IS_CLEAR(Port_Sim_SysCtlRegs[PORT_SIM_SYSCTL_RCGCGPIO], Port_Num))
+     || (Ahb != (boolean)(BIT_IS_SET(Port_Sim_SysCtlRegs[PORT_SIM_SYSCTL_GPIOHBCTL], Port_Num) != 0)) )
+    {
+      /* The port does not answer on this address, the access faults */
+      PORT_SIM_COUNT(Port_Sim_Counters.Bus_Faults, 1U);
+      return;
+    }
+    
+    Access->Reg = &Port_Sim_PortRegs[Port_Num][PORT_SIM_WORD(Access->Offset)];
+    Access->Counters = &Port_Sim_PortRegCounters[Port_Num][PORT_SIM_WORD(Access->Offset)];
+    return;
+  }
+  
+  switch(Address)
+  {
+    case SYSCTL_RCGCGPIO_REG_ADDRESS:
+    case SYSCTL_PRGPIO_REG_ADDRESS:   /* A port is modeled as ready as soon as its clock is enabled */
+      Access->Reg = &Port_Sim_SysCtlRegs[PORT_SIM_SYSCTL_RCGCGPIO];
+      Access->Counters = &Port_Sim_SysCtlCounters[PORT_SIM_SYSCTL_RCGCGPIO];
+      break;
+    case SYSCTL_GPIOHBCTL_REG_ADDRESS:
+      Access->Reg = &Port_Sim_SysCtlRegs[PORT_SIM_SYSCTL_GPIOHBCTL];
+      Access->Counters = &Port_Sim_SysCtlCounters[PORT_SIM_SYSCTL_GPIOHBCTL];
+      break;
+    case NVIC_EN0_REG_ADDRESS:
+      Access->Reg = &Port_Sim_SysCtlRegs[PORT_SIM_NVIC_EN0];
+      Access->Counters = &Port_Sim_SysCtlCounters[PORT_SIM_NVIC_EN0];
+      Access->Cycles = 1U;    /* Private peripheral bus of the core */
+      break;
+    default:
+      PORT_SIM_COUNT(Port_Sim_Counters.Unmapped, 1U);
+      break;
+  }
+}
+
+/* Lets another thread run before the access, as an interrupt taken between two instructions of the driver */
+STATIC void Port_Sim_Preempt( void )
+{
+  if((Port_Sim_PreemptPeriod != 0U) && (++Port_Sim_PreemptCount >= Port_Sim_PreemptPeriod))
+  {
+    Port_Sim_PreemptCount = 0;
+    (void)sched_yield();
+  }
+}
+
+/* Adds one access to the global, per API and per register counters */
+STATIC void Port_Sim_Count( const Port_Sim_AccessType * Access, boolean Write )
+{
+  Port_Sim_CountersType * Counters[3];
+  uint32 Cycles = (Write && Access->Alias) ? (2U * Access->Cycles) : Access->Cycles;
+  
+  Counters[0] = &Port_Sim_Counters;
+  Counters[1] = (Port_Sim_CurrentApi < PORT_SIM_API_SLOTS) ? &Port_Sim_ApiCounters[Port_Sim_CurrentApi] : NULL_PTR;
+  Counters[2] = Access->Counters;
+  
+  for(uint8 idx = 0; idx < 3U; idx++)
+  {
+    if(NULL_PTR == Counters[idx])
+    {
+      continue;
+    }
+    if(Write)
+    {
+      PORT_SIM_COUNT(Counters[idx]->Writes, 1U);
+      PORT_SIM_COUNT(Counters[idx]->Alias_Writes, Access->Alias ? 1U : 0U);
+    }
+    else
+    {
+      PORT_SIM_COUNT(Counters[idx]->Reads, 1U);
+    }
+    PORT_SIM_COUNT(Counters[idx]->Cycles, Cycles);
+  }
+}
+
+uint32 Port_Sim_Read( uint32 Address )
+{
+  Port_Sim_AccessType Access;
+  uint32 Value = 0;
+  
+  Port_Sim_Preempt();
+  Port_Sim_Decode(Address, &Access);
+  Port_Sim_Count(&Access, FALSE);
+  
+  if(NULL_PTR == Access.Reg)
+  {
+    return 0U;
+  }
+  
+  if((Access.Port_Num < PORT_NUMBER_OF_PORTS) && (Access.Offset == PORT_LOCK_REG_OFFSET))
+  {
+    Value = Port_Sim_Unlocked[Access.Port_Num] ? 0U : 1U;
+  }
+  else if((Access.Port_Num < PORT_NUMBER_OF_PORTS) && (Access.Offset == PORT_MASKED_INT_STATUS_REG_OFFSET))
+  {
+    Value = __atomic_load_n(&Port_Sim_PortRegs[Access.Port_Num][PORT_SIM_WORD(PORT_RAW_INT_STATUS_REG_OFFSET)], __ATOMIC_SEQ_CST)
+          & __atomic_load_n(&Port_Sim_PortRegs[Access.Port_Num][PORT_SIM_WORD(PORT_INT_MASK_REG_OFFSET)], __ATOMIC_SEQ_CST)
+          & Access.Data_Mask;
+  }
+  else
+  {
+    Value = __atomic_load_n(Access.Reg, __ATOMIC_SEQ_CST) & Access.Data_Mask;
+  }
+  
+  if(Access.Alias)
+  {
+    Value = (Value != 0U) ? 1U : 0U;
+  }
+  return Value;
+}
+
+/* Pins of port Port_Num whose level sensitive interrupt condition is present on the pad */
+STATIC uint32 Port_Sim_LevelsActive( uint8 Port_Num )
+{
+  uint32 Is = __atomic_load_n(&Port_Sim_PortRegs[Port_Num][PORT_SIM_WORD(PORT_INT_SENSE_REG_OFFSET)], __ATOMIC_SEQ_CST);
+  uint32 Iev = __atomic_load_n(&Port_Sim_PortRegs[Port_Num][PORT_SIM_WORD(PORT_INT_EVENT_REG_OFFSET)], __ATOMIC_SEQ_CST);
+  
+  return Is & ~(Iev ^ (uint32)Port_Sim_PadLevels[Port_Num]) & 0xFFU;
+}
+
+/* Bits of the register reached by a store of Access, LOCK, COMMIT and ICR stores are handled here and reach none */
+STATIC uint32 Port_Sim_StoreMask( const Port_Sim_AccessType * Access, uint32 Value )
+{
+  uint32 Mask = Access->Data_Mask;
+  
+  if(Access->Reg == &Port_Sim_SysCtlRegs[PORT_SIM_NVIC_EN0])
+  {
+    return Mask & Value;    /* Writing a 0 has no effect */
+  }
+  
+  if(Access->Port_Num < PORT_NUMBER_OF_PORTS)
+  {
+    uint32 Commit = __atomic_load_n(&Port_Sim_PortRegs[Access->Port_Num][PORT_SIM_WORD(PORT_COMMIT_REG_OFFSET)], __ATOMIC_SEQ_CST);
+    
+    switch(Access->Offset)
+    {
+      case PORT_LOCK_REG_OFFSET:
+        Port_Sim_Unlocked[Access->Port_Num] = (boolean)(Value == PORT_LOCK_KEY);
+        return 0U;
+        
+      case PORT_INT_CLEAR_REG_OFFSET:
+        /* Clears the latched edges, a level still present on the pad stays pending */
+        (void)__atomic_fetch_and(&Port_Sim_PortRegs[Access->Port_Num][PORT_SIM_WORD(PORT_RAW_INT_STATUS_REG_OFFSET)],
+                                 ~(Value & Mask & ~Port_Sim_LevelsActive(Access->Port_Num)), __ATOMIC_SEQ_CST);
+        return 0U;
+        
+      case PORT_RAW_INT_STATUS_REG_OFFSET:
+      case PORT_MASKED_INT_STATUS_REG_OFFSET:
+        return 0U;          /* Read-only */
+        
+      case PORT_COMMIT_REG_OFFSET:
+        if(!Port_Sim_Unlocked[Access->Port_Num])
+        {
+          return 0U;    /* GPIOCR is read-only while GPIOLOCK is locked */
+        }
+        break;
+        
+      case PORT_ALT_FUNC_REG_OFFSET:
+      case PORT_PULL_UP_REG_OFFSET:
+      case PORT_PULL_DOWN_REG_OFFSET:
+      case PORT_DIGITAL_ENABLE_REG_OFFSET:
+        Mask &= Commit;     /* Uncommitted bits keep their value */
+        break;
+        
+      default:
+        break;
+    }
+  }
+  return Mask;
+}
+
+void Port_Sim_Write( uint32 Address, uint32 Value )
+{
+  Port_Sim_AccessType Access;
+  uint32 Mask;
+  uint32 Old;
+  
+  Port_Sim_Preempt();
+  Port_Sim_Decode(Address, &Access);
+  Port_Sim_Count(&Access, TRUE);
+  
+  if(NULL_PTR == Access.Reg)
+  {
+    return;
+  }
+  
+  if(Access.Alias)
+  {
+    /* The bus matrix performs the read-modify-write of the target word, the core issues one store */
+    Value = (Value & 1U) ? 0xFFFFFFFFU : 0U;
+  }
+  
+  Mask = Port_Sim_StoreMask(&Access, Value);
+  
+  /* A store, and the read-modify-write of an alias store, is indivisible on the bus */
+  Old = __atomic_load_n(Access.Reg, __ATOMIC_SEQ_CST);
+  while(!__atomic_compare_exchange_n(Access.Reg, &Old, (Old & ~Mask) | (Value & Mask), FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+  {
+    /* Old holds the current value, retry */
+  }
+}
+
+uint32 Port_Sim_LoadExclusive( uint32 Address )
+{
+  Port_Sim_AccessType Access;
+  
+  Port_Sim_Preempt();
+  Port_Sim_Decode(Address, &Access);
+  if((NULL_PTR == Access.Reg) || Access.Alias || (Access.Data_Mask != 0xFFFFFFFFU))
+  {
+    /* Exclusive accesses are only modeled on whole registers */
+    Port_Sim_MonitorWord = NULL_PTR;
+    return Port_Sim_Read(Address);
+  }
+  Port_Sim_Count(&Access, FALSE);
+  return Port_Sim_LoadExclusiveWord(Access.Reg);
+}
+
+uint32 Port_Sim_StoreExclusive( uint32 Address, uint32 Value )
+{
+  Port_Sim_AccessType Access;
+  uint32 Mask;
+  uint32 Expected;
+  
+  Port_Sim_Preempt();
+  Expected = Port_Sim_MonitorValue;
+  Port_Sim_Decode(Address, &Access);
+  if((NULL_PTR == Access.Reg) || (Access.Reg != Port_Sim_MonitorWord))
+  {
+    /* No access is issued when the monitor does not hold the address */
+    Port_Sim_MonitorWord = NULL_PTR;
+    return 1U;
+  }
+  Port_Sim_MonitorWord = NULL_PTR;
+  
+  Mask = Port_Sim_StoreMask(&Access, Value);
+  if(!__atomic_compare_exchange_n(Access.Reg, &Expected, (Expected & ~Mask) | (Value & Mask), FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+  {
+    return 1U;
+  }
+  Port_Sim_Count(&Access, TRUE);
+  return 0U;
+}
+
+uint32 Port_Sim_LoadExclusiveWord( uint32* Word )
+{
+  Port_Sim_Preempt();
+  Port_Sim_MonitorWord = Word;
+  Port_Sim_MonitorValue = __atomic_load_n(Word, __ATOMIC_SEQ_CST);
+  return Port_Sim_MonitorValue;
+}
+
+uint32 Port_Sim_StoreExclusiveWord( uint32* Word, uint32 Value )
+{
+  uint32 Expected;
+  boolean Monitored;
+  
+  Port_Sim_Preempt();
+  Expected = Port_Sim_MonitorValue;
+  Monitored = (boolean)(Word == Port_Sim_MonitorWord);
+  
+  Port_Sim_MonitorWord = NULL_PTR;
+  if(!Monitored || !__atomic_compare_exchange_n(Word, &Expected, Value, FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+  {
+    return 1U;
+  }
+  return 0U;
+}
+
+void Port_Sim_EnterCritical( void )
+{
+  if(Port_Sim_CriticalDepth++ == 0U)
+  {
+    while(__atomic_test_and_set(&Port_Sim_CriticalLock, __ATOMIC_ACQUIRE))
+    {
+      (void)sched_yield();
+    }
+  }
+}
+
+void Port_Sim_ExitCritical( void )
+{
+  if(--Port_Sim_CriticalDepth == 0U)
+  {
+    __atomic_clear(&Port_Sim_CriticalLock, __ATOMIC_RELEASE);
+  }
+}
+
+void Port_Sim_Reset( void )
+{
+  for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+  {
+    for(uint32 idx = 0; idx < PORT_SIM_PORT_WORDS; idx++)
+    {
+      Port_Sim_PortRegs[Port_Num][idx] = 0;
+    }
+    Port_Sim_PortRegs[Port_Num][PORT_SIM_WORD(PORT_COMMIT_REG_OFFSET)] = 0xFFU & ~(uint32)Port_Sim_LockedPins[Port_Num];
+    Port_Sim_Unlocked[Port_Num] = FALSE;
+    Port_Sim_PadLevels[Port_Num] = 0;
+  }
+  
+  /* PC0 to PC3 come out of reset as JTAG/SWD pins */
+  Port_Sim_PortRegs[PORT_PORTC][PORT_SIM_WORD(PORT_ALT_FUNC_REG_OFFSET)] = 0x0FU;
+  Port_Sim_PortRegs[PORT_PORTC][PORT_SIM_WORD(PORT_DIGITAL_ENABLE_REG_OFFSET)] = 0x0FU;
+  Port_Sim_PortRegs[PORT_PORTC][PORT_SIM_WORD(PORT_PULL_UP_REG_OFFSET)] = 0x0FU;
+  Port_Sim_PortRegs[PORT_PORTC][PORT_SIM_WORD(PORT_CTL_REG_OFFSET)] = 0x00001111U;
+  
+  for(uint8 idx = 0; idx < PORT_SIM_SYSCTL_REGS; idx++)
+  {
+    Port_Sim_SysCtlRegs[idx] = 0;
+  }
+  
+  Port_Sim_PreemptPeriod = 0;
+  Port_Sim_ResetCounters();
+}
+
+void Port_Sim_ResetCounters( void )
+{
+  static const Port_Sim_CountersType Zero = {0};
+  
+  Port_Sim_Counters = Zero;
+  for(uint8 idx = 0; idx < PORT_SIM_API_SLOTS; idx++)
+  {
+    Port_Sim_ApiCounters[idx] = Zero;
+  }
+  for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+  {
+    for(uint32 idx = 0; idx < PORT_SIM_PORT_WORDS; idx++)
+    {
+      Port_Sim_PortRegCounters[Port_Num][idx] = Zero;
+    }
+  }
+  for(uint8 idx = 0; idx < PORT_SIM_SYSCTL_REGS; idx++)
+  {
+    Port_Sim_SysCtlCounters[idx] = Zero;
+  }
+  Port_Sim_CurrentApi = PORT_SIM_NO_API;
+}
+
+void Port_Sim_ApiEnter( uint8 ApiId )
+{
+  if(ApiId < PORT_SIM_API_SLOTS)
+  {
+    Port_Sim_ApiCounters[ApiId].Calls++;
+    Port_Sim_CurrentApi = ApiId;
+  }
+}
+
+void Port_Sim_ApiExit( uint8 ApiId )
+{
+  (void)ApiId;
+  Port_Sim_CurrentApi = PORT_SIM_NO_API;
+}
+
+void Port_Sim_SetPreemption( uint32 Period )
+{
+  Port_Sim_PreemptPeriod = Period;
+}
+
+void Port_Sim_SetPinLevel( uint8 Port_Num, uint8 Pin_Num, uint8 Level )
+{
+  uint32 * Regs = Port_Sim_PortRegs[Port_Num];
+  uint32 Pin_Mask = (uint32)1 << Pin_Num;
+  boolean Changed = (boolean)(((Port_Sim_PadLevels[Port_Num] & Pin_Mask) != 0U) != (Level != STD_LOW));
+  uint32 Iev = Regs[PORT_SIM_WORD(PORT_INT_EVENT_REG_OFFSET)] & Pin_Mask;
+  
+  if(Level != STD_LOW)
+  {
+    Port_Sim_PadLevels[Port_Num] |= (uint8)Pin_Mask;
+  }
+  else
+  {
+    Port_Sim_PadLevels[Port_Num] &= (uint8)~Pin_Mask;
+  }
+  
+  /* An input reads its pad, an output keeps the level it drives */
+  if((Regs[PORT_SIM_WORD(PORT_DIR_REG_OFFSET)] & Pin_Mask) == 0U)
+  {
+    Regs[PORT_SIM_WORD(PORT_DATA_REG_OFFSET)] = (Regs[PORT_SIM_WORD(PORT_DATA_REG_OFFSET)] & ~Pin_Mask)
+                                              | (Port_Sim_PadLevels[Port_Num] & Pin_Mask);
+  }
+  
+  /* Latch the condition selected by GPIOIS, GPIOIBE and GPIOIEV, levels are only sampled here */
+  if( ((Port_Sim_LevelsActive(Port_Num) & Pin_Mask) != 0U)
+   || ( ((Regs[PORT_SIM_WORD(PORT_INT_SENSE_REG_OFFSET)] & Pin_Mask) == 0U) && Changed
+     && ( ((Regs[PORT_SIM_WORD(PORT_INT_BOTH_EDGES_REG_OFFSET)] & Pin_Mask) != 0U)
+       || ((Iev != 0U) == (Level != STD_LOW)) ) ) )
+  {
+    Regs[PORT_SIM_WORD(PORT_RAW_INT_STATUS_REG_OFFSET)] |= Pin_Mask;
+  }
+  
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+  /* Take the port interrupt now if the pin is armed and its vector enabled */
+  if( ((Regs[PORT_SIM_WORD(PORT_RAW_INT_STATUS_REG_OFFSET)] & Regs[PORT_SIM_WORD(PORT_INT_MASK_REG_OFFSET)] & Pin_Mask) != 0U)
+   && BIT_IS_SET(Port_Sim_SysCtlRegs[PORT_SIM_NVIC_EN0], Port_Sim_IrqNumber[Port_Num]) )
+  {
+    uint8 Interrupted_Api = Port_Sim_CurrentApi;
+    
+    Port_Sim_Vector[Port_Num]();
+    Port_Sim_CurrentApi = Interrupted_Api;
+  }
+#endif
+}
+
+uint32 Port_Sim_GetTime( void )
+{
+  struct timespec Now;
+  
+  (void)clock_gettime(CLOCK_MONOTONIC, &Now);
+  return (uint32)((uint64)Now.tv_sec * 1000000000U + (uint64)Now.tv_nsec);
+}
+
+void Port_Sim_GetCounters( Port_Sim_CountersType* Counters )
+{
+  *Counters = Port_Sim_Counters;
+}
+
+void Port_Sim_GetApiCounters( uint8 ApiId, Port_Sim_CountersType* Counters )
+{
+  static const Port_Sim_CountersType Zero = {0};
+  
+  *Counters = (ApiId < PORT_SIM_API_SLOTS) ? Port_Sim_ApiCounters[ApiId] : Zero;
+}
+
+void Port_Sim_GetRegisterCounters( uint32 Address, Port_Sim_CountersType* Counters )
+{
+  static const Port_Sim_CountersType Zero = {0};
+  Port_Sim_AccessType Access;
+  uint32 Bus_Faults = Port_Sim_Counters.Bus_Faults;
+  uint32 Unmapped = Port_Sim_Counters.Unmapped;
+  
+  Port_Sim_Decode(Address, &Access);
+  
+  /* Looking the register up is not an access */
+  Port_Sim_Counters.Bus_Faults = Bus_Faults;
+  Port_Sim_Counters.Unmapped = Unmapped;
+  
+  *Counters = (NULL_PTR == Access.Counters) ? Zero : *Access.Counters;
+}
+
+#endif /* PORT_HOST_SIMULATION */
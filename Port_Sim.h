@@ -0,0 +1,112 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Sim.h
+ *
+ * Description: Header file for the host simulation of the TM4C123GH6PM GPIO and
+ *              System Control registers used when PORT_HOST_SIMULATION is STD_ON.
+ *
+ * Author: Ahmed Wael
+ ******************************************************************************/
+
+#ifndef PORT_SIM_H
+#define PORT_SIM_H
+
+#include "Std_Types.h"
+
+/* Modeled bus cycles of one access through the APB aperture (System Control included) */
+#ifndef PORT_SIM_APB_ACCESS_CYCLES
+#define PORT_SIM_APB_ACCESS_CYCLES        (2U)
+#endif
+
+/* Modeled bus cycles of one access through the AHB aperture */
+#ifndef PORT_SIM_AHB_ACCESS_CYCLES
+#define PORT_SIM_AHB_ACCESS_CYCLES        (1U)
+#endif
+
+/* Number of API service Ids the accesses can be attributed to */
+#define PORT_SIM_API_SLOTS                (32U)
+
+/* Attribution slot of the accesses done outside of any API */
+#define PORT_SIM_NO_API                   (0xFFU)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/*Type definition for the bus access counters of the simulated registers*/
+typedef struct
+{
+  uint32 Calls;         /* API calls, only used by the per API counters */
+  uint32 Reads;         /* Loads issued by the driver */
+  uint32 Writes;        /* Stores issued by the driver, bit-band alias stores included */
+  uint32 Alias_Writes;  /* Stores issued to the bit-band alias region */
+  uint32 Cycles;        /* Modeled bus cycles, a bit-band store costs a read and a write of the target */
+  uint32 Bus_Faults;    /* Accesses to a port without clock or through the aperture not selected in GPIOHBCTL */
+  uint32 Unmapped;      /* Accesses outside of the simulated registers */
+  
+}Port_Sim_CountersType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/*Returns the simulated register at Address, bit-band alias and masked GPIODATA addresses are translated*/
+uint32 Port_Sim_Read( uint32 Address );
+
+/*Writes the simulated register at Address, bit-band alias and masked GPIODATA addresses are translated*/
+void Port_Sim_Write( uint32 Address, uint32 Value );
+
+/*Exclusive load of the simulated register at Address, arms the exclusive monitor of the calling thread*/
+uint32 Port_Sim_LoadExclusive( uint32 Address );
+
+/*Exclusive store of the simulated register at Address, returns 0 if it was written, 1 if the register
+  changed since the exclusive load of the calling thread*/
+uint32 Port_Sim_StoreExclusive( uint32 Address, uint32 Value );
+
+/*Exclusive load and store of a RAM word, same monitor as the register versions*/
+uint32 Port_Sim_LoadExclusiveWord( uint32* Word );
+uint32 Port_Sim_StoreExclusiveWord( uint32* Word, uint32 Value );
+
+/*Puts all simulated registers in their reset state and clears all counters*/
+void Port_Sim_Reset( void );
+
+/*Clears all counters, the simulated registers keep their values*/
+void Port_Sim_ResetCounters( void );
+
+/*Marks the start of the API ApiId, the following accesses are attributed to it*/
+void Port_Sim_ApiEnter( uint8 ApiId );
+
+/*Marks the end of the API ApiId*/
+void Port_Sim_ApiExit( uint8 ApiId );
+
+/*Masks the simulated interrupts: until Port_Sim_ExitCritical no other thread enters a critical section,
+  the sections of one thread may nest*/
+void Port_Sim_EnterCritical( void );
+
+/*Ends the critical section of Port_Sim_EnterCritical*/
+void Port_Sim_ExitCritical( void );
+
+/*Makes every Period-th access of a thread yield the host CPU first, so other threads run between two
+  accesses of a read-modify-write as an interrupt would, 0 disables it (Port_Sim_Reset)*/
+void Port_Sim_SetPreemption( uint32 Period );
+
+/*Applies Level to the pad of pin Pin_Num of port Port_Num: an input pin reads it, the edge or level selected
+  for the pin is latched in GPIORIS and, if the pin is armed and its port vector enabled in the NVIC, the GPIO
+  port handler is called before returning. A level is only sampled when injected*/
+void Port_Sim_SetPinLevel( uint8 Port_Num, uint8 Pin_Num, uint8 Level );
+
+/*Returns the host monotonic clock in nanoseconds, wrapping modulo 2^32*/
+uint32 Port_Sim_GetTime( void );
+
+/*Copies the counters of all accesses since the last reset*/
+void Port_Sim_GetCounters( Port_Sim_CountersType* Counters );
+
+/*Copies the counters of the accesses done by the API ApiId since the last reset*/
+void Port_Sim_GetApiCounters( uint8 ApiId, Port_Sim_CountersType* Counters );
+
+/*Copies the counters of the accesses to the register at Address since the last reset*/
+void Port_Sim_GetRegisterCounters( uint32 Address, Port_Sim_CountersType* Counters );
+
+#endif /* PORT_SIM_H */
@@ -12,6 +12,8 @@
 #pragma language=extended
 #pragma segment="CSTACK"
 
+#include "Port.h"
+
 extern void __iar_program_start( void );
 
 extern void NMI_Handler( void );
@@ -23,6 +25,12 @@ extern void SVC_Handler( void );
 extern void DebugMon_Handler( void );
 extern void PendSV_Handler( void );
 extern void SysTick_Handler( void );
+extern void GPIOA_Handler( void );
+extern void GPIOB_Handler( void );
+extern void GPIOC_Handler( void );
+extern void GPIOD_Handler( void );
+extern void GPIOE_Handler( void );
+extern void GPIOF_Handler( void );
 
 typedef void( *intfunc )( void );
 typedef union { intfunc __fun; void * __ptr; } intvec_elem;
@@ -56,7 +64,40 @@ const intvec_elem __vector_table[] =
   DebugMon_Handler,
   0,
   PendSV_Handler,
-  SysTick_Handler
+  SysTick_Handler,
+
+  // External interrupts, only the GPIO ports are used (Port_Isr)
+  GPIOA_Handler,                          // IRQ0
+  GPIOB_Handler,                          // IRQ1
+  GPIOC_Handler,                          // IRQ2
+  GPIOD_Handler,                          // IRQ3
+  GPIOE_Handler,                          // IRQ4
+  0,                                      // IRQ5
+  0,                                      // IRQ6
+  0,                                      // IRQ7
+  0,                                      // IRQ8
+  0,                                      // IRQ9
+  0,                                      // IRQ10
+  0,                                      // IRQ11
+  0,                                      // IRQ12
+  0,                                      // IRQ13
+  0,                                      // IRQ14
+  0,                                      // IRQ15
+  0,                                      // IRQ16
+  0,                                      // IRQ17
+  0,                                      // IRQ18
+  0,                                      // IRQ19
+  0,                                      // IRQ20
+  0,                                      // IRQ21
+  0,                                      // IRQ22
+  0,                                      // IRQ23
+  0,                                      // IRQ24
+  0,                                      // IRQ25
+  0,                                      // IRQ26
+  0,                                      // IRQ27
+  0,                                      // IRQ28
+  0,                                      // IRQ29
+  GPIOF_Handler                           // IRQ30
 
 };
 
@@ -78,6 +119,18 @@ __weak void DebugMon_Handler( void ) { while (1) {} }
 __weak void PendSV_Handler( void ) { while (1) {} }
 #pragma call_graph_root = "interrupt"
 __weak void SysTick_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOA_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOB_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOC_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOD_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOE_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOF_Handler( void ) { while (1) {} }
 
 
 void __cmain( void );
@@ -87,6 +140,11 @@ __weak void __iar_init_vfp( void );
 #pragma required=__vector_table
 void __iar_program_start( void )
 {
+#if (PORT_EARLY_INIT_API == STD_ON)
+  // Safe state of the critical pins first, Port_EarlyInit uses no RAM
+  // variable so it runs before __cmain initializes them.
+  Port_EarlyInit( &Port_PinConfiguration );
+#endif
   __iar_init_core();
   __iar_init_vfp();
   __cmain();
@@ -0,0 +1,442 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Bench.c
+ *
+ * Description: Host benchmark runner of the Port Driver. It is linked with one
+ *              configuration (Port_PBcfg.c or a tools/Port_Bench_*.c set) and the
+ *              simulated registers of Port_Sim.c, runs every API over the pins of
+ *              that configuration and prints one line per API:
+ *                  <API> <calls> <reads> <writes> <cycles>
+ *              Built and compared against the baseline by tools/Port_Bench.py.
+ *
+ * Author: Ahmed Wael
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Port.h"
+#include "Port_Regs.h"
+
+#if (PORT_HOST_SIMULATION != STD_ON)
+#error "Port_Bench.c needs PORT_HOST_SIMULATION set to STD_ON"
+#endif
+
+STATIC uint32 Port_Bench_DetErrors = 0;
+
+/* Every development error raised while benchmarking is a failure of the run */
+Std_ReturnType Det_ReportError( uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId )
+{
+  printf("DET module %u instance %u API 0x%02X error 0x%02X\n", ModuleId, InstanceId, ApiId, ErrorId);
+  Port_Bench_DetErrors++;
+  return E_OK;
+}
+
+STATIC void Port_Bench_Report( const char * Name, uint8 ApiId )
+{
+  Port_Sim_CountersType Counters;
+
+  Port_Sim_GetApiCounters(ApiId, &Counters);
+  printf("%s %lu %lu %lu %lu\n", Name, (unsigned long)Counters.Calls, (unsigned long)Counters.Reads,
+         (unsigned long)Counters.Writes, (unsigned long)Counters.Cycles);
+}
+
+/* Notification of the armed pins of tools/Port_Bench_Mixed.c */
+STATIC uint32 Port_Bench_Notifications = 0;
+
+void Port_Bench_Notification( void )
+{
+  Port_Bench_Notifications++;
+}
+
+/* Pins the configuration owns, the protected JTAG pins are rejected by the runtime APIs */
+#define PORT_BENCH_PIN_OWNED(CONFIG,PIN) \
+  (((CONFIG)->Port[PORT_PIN_CFG_PORT_NUM((CONFIG)->Pin[PIN])].Mask & (CONFIG)->Pin_Desc[PIN].Mask) != 0U)
+
+#if (PORT_DEBOUNCE_API == STD_ON)
+
+/* Attribution slot of the per pin reference debouncer, above the driver service Ids */
+#define PORT_BENCH_PER_PIN_DEBOUNCE_SLOT  (uint8)(PORT_SIM_API_SLOTS - 1U)
+
+/* Ticks of the debouncing comparison */
+#define PORT_BENCH_DEBOUNCE_TICKS         (64U)
+
+/* State of the per pin debouncer that Port_DebounceTick replaces: one read and one counter per pin */
+STATIC uint8 Port_Bench_PinLevel[PORT_CONFIGURED_PINS];
+STATIC uint8 Port_Bench_PinCount[PORT_CONFIGURED_PINS];
+
+/* Same acceptance rule as Port_DebounceTick, run pin by pin (Load TRUE takes the current levels) */
+STATIC void Port_Bench_PerPinDebounce( const Port_ConfigType * Config, boolean Load )
+{
+  Port_Sim_ApiEnter(PORT_BENCH_PER_PIN_DEBOUNCE_SLOT);
+  for(Port_PinType Pin = 0; Pin < PORT_CONFIGURED_PINS; Pin++)
+  {
+    uint8 Samples = PORT_PIN_CFG_DEBOUNCE(Config->Pin[Pin]);
+    uint8 Level;
+
+    if((Samples == 0) || !PORT_BENCH_PIN_OWNED(Config, Pin))
+    {
+      continue;
+    }
+    /* GPIODATA address masked to the pin, from the group address of its port */
+    Level = (PORT_READ_REG(PORT_DATA_MASKED_ADDRESS(Config->Group[PORT_PIN_CFG_PORT_NUM(Config->Pin[Pin])].Data_Address & ~(uint32)PORT_DATA_REG_OFFSET ,
+                                                    Config->Pin_Desc[Pin].Mask)) != 0U) ? STD_HIGH : STD_LOW;
+    if(Load || (Level == Port_Bench_PinLevel[Pin]))
+    {
+      Port_Bench_PinLevel[Pin] = Level;
+      Port_Bench_PinCount[Pin] = Samples;
+    }
+    else if(Port_Bench_PinCount[Pin] == 0)
+    {
+      Port_Bench_PinLevel[Pin] = Level;
+      Port_Bench_PinCount[Pin] = Samples;
+    }
+    else
+    {
+      Port_Bench_PinCount[Pin]--;
+    }
+  }
+  Port_Sim_ApiExit(PORT_BENCH_PER_PIN_DEBOUNCE_SLOT);
+}
+
+#endif
+
+int main( void )
+{
+  const Port_ConfigType * Config = &Port_PinConfiguration;
+  Port_Sim_CountersType Counters;
+
+  Port_Sim_Reset();
+#if (PORT_EARLY_INIT_API == STD_ON)
+  /* First phase right after reset, its modeled cycles are the time until the critical pins reach their safe state */
+  Port_EarlyInit(Config);
+#endif
+  Port_Init(Config);
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+  /* Turn every changeable pin around and back to its configured direction */
+  for(Port_PinType Pin = 0; Pin < PORT_CONFIGURED_PINS; Pin++)
+  {
+    if((PORT_PIN_CFG_CHANGE_DIRECTION(Config->Pin[Pin]) == Change) && PORT_BENCH_PIN_OWNED(Config, Pin))
+    {
+      Port_PinDirectionType Direction = (Port_PinDirectionType)PORT_PIN_CFG_DIRECTION(Config->Pin[Pin]);
+
+      Port_SetPinDirection(Pin, (Direction == PORT_PIN_OUT) ? PORT_PIN_IN : PORT_PIN_OUT);
+      Port_SetPinDirection(Pin, Direction);
+    }
+  }
+#endif
+
+  /* Apply again the configured mode of every changeable pin */
+  for(Port_PinType Pin = 0; Pin < PORT_CONFIGURED_PINS; Pin++)
+  {
+    if((PORT_PIN_CFG_CHANGE_MODE(Config->Pin[Pin]) == Change) && PORT_BENCH_PIN_OWNED(Config, Pin))
+    {
+      Port_SetPinMode(Pin, (Port_PinModeType)PORT_PIN_CFG_MODE(Config->Pin[Pin]));
+    }
+  }
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+  /* Same turn around with one group call per direction, the pins configured as inputs and as outputs */
+  for(uint8 Direction = PORT_PIN_IN; Direction <= PORT_PIN_OUT; Direction++)
+  {
+    Port_PinType Pins[PORT_CONFIGURED_PINS];
+    uint8 Count = 0;
+
+    for(Port_PinType Pin = 0; Pin < PORT_CONFIGURED_PINS; Pin++)
+    {
+      if((PORT_PIN_CFG_CHANGE_DIRECTION(Config->Pin[Pin]) == Change) && PORT_BENCH_PIN_OWNED(Config, Pin) && (PORT_PIN_CFG_DIRECTION(Config->Pin[Pin]) == Direction))
+      {
+        Pins[Count++] = Pin;
+      }
+    }
+    if(Count != 0)
+    {
+      Port_SetPinDirections(Pins, Count, (Direction == PORT_PIN_OUT) ? PORT_PIN_IN : PORT_PIN_OUT);
+      Port_SetPinDirections(Pins, Count, (Port_PinDirectionType)Direction);
+    }
+  }
+#endif
+
+  /* Same modes with one group call per configured mode */
+  for(uint8 Mode = PORT_PIN_MODE_ADC; Mode <= PORT_PIN_MODE_GPIO; Mode++)
+  {
+    Port_PinType Pins[PORT_CONFIGURED_PINS];
+    uint8 Count = 0;
+
+    for(Port_PinType Pin = 0; Pin < PORT_CONFIGURED_PINS; Pin++)
+    {
+      if((PORT_PIN_CFG_CHANGE_MODE(Config->Pin[Pin]) == Change) && PORT_BENCH_PIN_OWNED(Config, Pin) && (PORT_PIN_CFG_MODE(Config->Pin[Pin]) == Mode))
+      {
+        Pins[Count++] = Pin;
+      }
+    }
+    if(Count != 0)
+    {
+      Port_SetPinModes(Pins, Count, Mode);
+    }
+  }
+
+  Port_RefreshPortDirection();
+
+#if (PORT_MAIN_FUNCTION_API == STD_ON)
+  /* One background round over the used ports with the shipped budget of one port per call */
+  for(uint8 Call = 0; Call < PORT_NUMBER_OF_PORTS; Call++)
+  {
+    Port_MainFunction();
+  }
+  
+  /* Every runtime update kept its register and shadow in step, a repaired register is a failure of the run */
+  {
+    uint8 Drift[PORT_NUMBER_OF_PORTS];
+    
+    if(Port_GetMainFunctionDrift(Drift) != E_OK)
+    {
+      Port_Bench_DetErrors++;
+    }
+  }
+#endif
+
+#if (PORT_WRITE_LEVEL_API == STD_ON)
+  /* Drive every output pin high then low, then every used port at once */
+  for(Port_PinType Pin = 0; Pin < PORT_CONFIGURED_PINS; Pin++)
+  {
+    if(PORT_PIN_CFG_DIRECTION(Config->Pin[Pin]) == PORT_PIN_OUT)
+    {
+      Port_WritePinLevel(Pin, STD_HIGH);
+      Port_WritePinLevel(Pin, STD_LOW);
+    }
+  }
+  for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+  {
+    if(Config->Port[Port_Num].Mask != 0)
+    {
+      Port_WritePortLevel(Port_Num, 0xFF, 0x00);
+    }
+  }
+#endif
+
+  /* Take every precomputed configuration switch once, then come back to the initial set */
+  {
+    const Port_ConfigType * Current = Config;
+    
+    for(const Port_ConfigSwitchType * Switch = Port_ConfigSwitches; Switch->From != NULL_PTR; Switch++)
+    {
+      if(Current != Switch->From)
+      {
+        Port_SwitchConfig(Current, Switch->From);
+      }
+      Port_SwitchConfig(Switch->From, Switch->To);
+      Current = Switch->To;
+    }
+    Port_SwitchConfig(Current, Config);
+  }
+
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+  {
+    uint32 Expected = 0;
+    
+    /* Pulse every armed pin high then low, both edges pins notify twice, the other senses once */
+    for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+    {
+      for(uint8 Pin_Num = 0; Pin_Num < PORT_PINS_PER_PORT; Pin_Num++)
+      {
+        if(BIT_IS_SET(Config->Irq[Port_Num].Im, Pin_Num))
+        {
+          Port_Sim_SetPinLevel(Port_Num, Pin_Num, STD_HIGH);
+          Port_Sim_SetPinLevel(Port_Num, Pin_Num, STD_LOW);
+          if(Port_PinNotifications[Port_Num][Pin_Num] != NULL_PTR)
+          {
+            Expected += BIT_IS_SET(Config->Irq[Port_Num].Ibe, Pin_Num) ? 2U : 1U;
+          }
+        }
+      }
+    }
+    if(Port_Bench_Notifications != Expected)
+    {
+      printf("%lu pin notifications, %lu expected\n", (unsigned long)Port_Bench_Notifications, (unsigned long)Expected);
+      Port_Bench_DetErrors++;
+    }
+  }
+#endif
+
+#if (PORT_DEBOUNCE_API == STD_ON)
+  {
+    uint32 Seed = 1U;
+
+    /* Stable inputs for the deepest count first, both debouncers then hold the current levels */
+    Port_Bench_PerPinDebounce(Config, TRUE);
+    for(uint32 Tick = 0; Tick <= PORT_PIN_CFG_DEBOUNCE_MASK; Tick++)
+    {
+      Port_DebounceTick();
+    }
+    
+    /* Bounce the debounced inputs at random and check both debouncers accept the same levels every tick */
+    for(uint32 Tick = 0; Tick < PORT_BENCH_DEBOUNCE_TICKS; Tick++)
+    {
+      for(Port_PinType Pin = 0; Pin < PORT_CONFIGURED_PINS; Pin++)
+      {
+        Seed = (Seed * 1664525U) + 1013904223U;
+        if((PORT_PIN_CFG_DEBOUNCE(Config->Pin[Pin]) != 0) && ((Seed >> 24) < 48U))
+        {
+          uint8 Port_Num = PORT_PIN_CFG_PORT_NUM(Config->Pin[Pin]);
+          uint8 Pin_Num = PORT_PIN_CFG_PIN_NUM(Config->Pin[Pin]);
+
+          Port_Sim_SetPinLevel(Port_Num, Pin_Num, (Tick & 1U) ? STD_HIGH : STD_LOW);
+        }
+      }
+      Port_DebounceTick();
+      Port_Bench_PerPinDebounce(Config, FALSE);
+
+      for(Port_PinType Pin = 0; Pin < PORT_CONFIGURED_PINS; Pin++)
+      {
+        if( (PORT_PIN_CFG_DEBOUNCE(Config->Pin[Pin]) != 0) && PORT_BENCH_PIN_OWNED(Config, Pin)
+         && (Port_GetDebouncedLevel(Pin) != Port_Bench_PinLevel[Pin]) )
+        {
+          printf("Tick %lu: debounced level of pin %u differs from the per pin debouncer\n", (unsigned long)Tick, Pin);
+          Port_Bench_DetErrors++;
+        }
+      }
+    }
+  }
+#endif
+
+#if (PORT_SNAPSHOT_API == STD_ON)
+  {
+    uint64 Before = Port_Snapshot();
+    uint64 Expected_Rising = 0;
+    uint64 Expected_Falling = 0;
+    uint64 Rising;
+    uint64 Falling;
+    
+    /* Invert the pad of every other owned input pin that raises no interrupt, then find them back as edges */
+    for(Port_PinType Pin = 0; Pin < PORT_CONFIGURED_PINS; Pin += 2U)
+    {
+      uint8 Port_Num = PORT_PIN_CFG_PORT_NUM(Config->Pin[Pin]);
+      uint8 Pin_Num = PORT_PIN_CFG_PIN_NUM(Config->Pin[Pin]);
+      uint64 Bit = PORT_SNAPSHOT_BIT(Port_Num, Pin_Num);
+      
+      if( PORT_BENCH_PIN_OWNED(Config, Pin) && BIT_IS_CLEAR(Config->Port[Port_Num].Dir, Pin_Num)
+       && BIT_IS_CLEAR(Config->Irq[Port_Num].Im, Pin_Num) )
+      {
+        Port_Sim_SetPinLevel(Port_Num, Pin_Num, ((Before & Bit) != 0U) ? STD_LOW : STD_HIGH);
+        if((Before & Bit) != 0U)
+        {
+          Expected_Falling |= Bit;
+        }
+        else
+        {
+          Expected_Rising |= Bit;
+        }
+      }
+    }
+    (void)Port_Snapshot();
+    Port_GetEdges(&Rising, &Falling);
+    if((Rising != Expected_Rising) || (Falling != Expected_Falling))
+    {
+      printf("Edges rising 0x%016llX falling 0x%016llX, expected 0x%016llX 0x%016llX\n", (unsigned long long)Rising,
+             (unsigned long long)Falling, (unsigned long long)Expected_Rising, (unsigned long long)Expected_Falling);
+      Port_Bench_DetErrors++;
+    }
+  }
+#endif
+
+#if (PORT_SLEEP_API == STD_ON)
+  {
+    Port_StateType Saved = {0};
+    Port_StateType Restored = {0};
+    
+    /* Sleep entry then wake up, the sleeping pins must hold their image and every register its saved content */
+    Port_SaveState(&Saved);
+    Port_EnterSleep();
+    for(uint8 Port_Num = 0; Port_Num < PORT_NUMBER_OF_PORTS; Port_Num++)
+    {
+      const Port_SleepImageType * Image = &Config->Sleep[Port_Num];
+      uint32 Base = Image->Data_Address & ~0xFFFU;
+      const uint32 Expected[][2] =
+      {
+        { PORT_ANALOG_MODE_SEL_REG_OFFSET, Image->Amsel }, { PORT_ALT_FUNC_REG_OFFSET, Image->Afsel },
+        { PORT_PULL_UP_REG_OFFSET, Image->Pur }, { PORT_PULL_DOWN_REG_OFFSET, Image->Pdr },
+        { PORT_DATA_REG_OFFSET, Image->Data }, { PORT_DIR_REG_OFFSET, Image->Dir },
+        { PORT_DIGITAL_ENABLE_REG_OFFSET, Image->Den },
+      };
+      
+      for(uint8 idx = 0; (Image->Mask != 0) && (idx < (sizeof(Expected) / sizeof(Expected[0]))); idx++)
+      {
+        if((PORT_READ_REG(Base + Expected[idx][0]) & Image->Mask) != Expected[idx][1])
+        {
+          printf("Port %u register 0x%03lX does not hold its sleep image\n", Port_Num, (unsigned long)Expected[idx][0]);
+          Port_Bench_DetErrors++;
+        }
+      }
+    }
+    Port_RestoreState(&Saved);
+    Port_SaveState(&Restored);
+    if(memcmp(&Saved, &Restored, sizeof(Saved)) != 0)
+    {
+      printf("Port_RestoreState did not restore the saved registers\n");
+      Port_Bench_DetErrors++;
+    }
+  }
+#endif
+
+#if (PORT_VERIFY_CONFIG_API == STD_ON)
+  {
+    uint8 Mismatch[PORT_NUMBER_OF_PORTS];
+    
+    /* The APIs above only changed changeable pins, the configuration must still match */
+    if(Port_VerifyConfig(Mismatch) != E_OK)
+    {
+      Port_Bench_DetErrors++;
+    }
+  }
+#endif
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+  {
+    uint8 Drift[PORT_NUMBER_OF_PORTS];
+
+    /* Every runtime update went through the shadow, a drift is a failure of the run */
+    if(Port_CheckShadow(Drift) != E_OK)
+    {
+      Port_Bench_DetErrors++;
+    }
+  }
+#endif
+
+  Port_Bench_Report("Port_EarlyInit", Port_EarlyInit_SID);
+  Port_Bench_Report("Port_Init", Port_Init_SID);
+  Port_Bench_Report("Port_SetPinDirection", Port_SetPinDirection_SID);
+  Port_Bench_Report("Port_SetPinMode", Port_SetPinMode_SID);
+  Port_Bench_Report("Port_SetPinDirections", Port_SetPinDirections_SID);
+  Port_Bench_Report("Port_SetPinModes", Port_SetPinModes_SID);
+  Port_Bench_Report("Port_RefreshPortDirection", Port_RefreshPortDirection_SID);
+  Port_Bench_Report("Port_MainFunction", Port_MainFunction_SID);
+  Port_Bench_Report("Port_GetMainFunctionDrift", Port_GetMainFunctionDrift_SID);
+  Port_Bench_Report("Port_WritePinLevel", Port_WritePinLevel_SID);
+  Port_Bench_Report("Port_WritePortLevel", Port_WritePortLevel_SID);
+  Port_Bench_Report("Port_CheckShadow", Port_CheckShadow_SID);
+  Port_Bench_Report("Port_SwitchConfig", Port_SwitchConfig_SID);
+  Port_Bench_Report("Port_VerifyConfig", Port_VerifyConfig_SID);
+  Port_Bench_Report("Port_Isr", Port_Isr_SID);
+  Port_Bench_Report("Port_DebounceTick", Port_DebounceTick_SID);
+  Port_Bench_Report("Port_Snapshot", Port_Snapshot_SID);
+  Port_Bench_Report("Port_SaveState", Port_SaveState_SID);
+  Port_Bench_Report("Port_RestoreState", Port_RestoreState_SID);
+  Port_Bench_Report("Port_EnterSleep", Port_EnterSleep_SID);
+#if (PORT_DEBOUNCE_API == STD_ON)
+  Port_Bench_Report("Port_DebouncePerPin", PORT_BENCH_PER_PIN_DEBOUNCE_SLOT);
+#endif
+
+  /* Accesses the model could not serve and development errors make the run invalid */
+  Port_Sim_GetCounters(&Counters);
+  if((Port_Bench_DetErrors != 0) || (Counters.Bus_Faults != 0) || (Counters.Unmapped != 0))
+  {
+    printf("Invalid run: %lu development errors, %lu bus faults, %lu unmapped accesses\n",
+           (unsigned long)Port_Bench_DetErrors, (unsigned long)Counters.Bus_Faults, (unsigned long)Counters.Unmapped);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""
+ Module: Port
+
+ File Name: Port_Bench.py
+
+ Description: Host benchmark of the TM4C123GH6PM Port Driver. Every scenario
+              configuration is built with tools/Port_Bench.c and the simulated
+              registers of Port_Sim.c, and the MMIO reads, writes and modeled
+              bus cycles of each API are compared with the recorded baseline.
+              Any API doing more register traffic than its baseline fails the
+              comparison.
+
+ Usage: python3 tools/Port_Bench.py [--update] [--cc=gcc] [-DNAME=VALUE ...]
+        --update  record the current numbers as the new baseline.
+        --cc      host C compiler, gcc by default.
+        -D        extra symbols passed to the compiler, e.g.
+                  -DPORT_SIM_APB_ACCESS_CYCLES=3U (the baseline is recorded with none).
+"""
+
+import os
+import subprocess
+import sys
+import tempfile
+
+REPO_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+TOOLS_DIR = os.path.join(REPO_DIR, "tools")
+BASELINE = os.path.join(TOOLS_DIR, "Port_Bench_Baseline.txt")
+
+# (scenario, configuration source, number of configured pins)
+SCENARIOS = (
+    ("shipped", os.path.join(REPO_DIR, "Port_PBcfg.c"), 43),
+    ("all_gpio", os.path.join(TOOLS_DIR, "Port_Bench_AllGpio.c"), 43),
+    ("mixed", os.path.join(TOOLS_DIR, "Port_Bench_Mixed.c"), 43),
+    ("sparse", os.path.join(TOOLS_DIR, "Port_Bench_Sparse.c"), 6),
+)
+
+METRICS = ("calls", "reads", "writes", "cycles")
+
+
+class BenchError(Exception):
+    pass
+
+
+def run_scenario(name, config, pins, cc, defines, workdir):
+    """Build and run one scenario, return {API: {metric: value}}."""
+    pin_define = "-DPORT_CONFIGURED_PINS=%dU" % pins
+    generator = [sys.executable, os.path.join(TOOLS_DIR, "Port_Generator.py"), "--check",
+                 "-DPORT_CONFIGURED_PINS=%d" % pins, config]
+    if subprocess.call(generator) != 0:
+        raise BenchError("%s: generated region of %s is not up to date" % (name, config))
+
+    binary = os.path.join(workdir, "Port_Bench_" + name)
+    command = [cc, "-O2", "-std=c99", "-DPORT_HOST_SIMULATION=STD_ON", pin_define] + defines + [
+        "-I" + REPO_DIR, "-o", binary,
+        os.path.join(REPO_DIR, "Port.c"), os.path.join(REPO_DIR, "Port_PinMux.c"), os.path.join(REPO_DIR, "Port_Sim.c"),
+        config, os.path.join(TOOLS_DIR, "Port_Bench.c")]
+    build = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if build.returncode != 0:
+        raise BenchError("%s: build failed\n%s" % (name, build.stdout))
+
+    run = subprocess.run([binary], stdout=subprocess.PIPE, universal_newlines=True)
+    if run.returncode != 0:
+        raise BenchError("%s: run failed\n%s" % (name, run.stdout))
+
+    results = {}
+    for line in run.stdout.splitlines():
+        fields = line.split()
+        results[fields[0]] = dict(zip(METRICS, (int(value) for value in fields[1:])))
+    return results
+
+
+def load_baseline():
+    baseline = {}
+    with open(BASELINE) as f:
+        for line in f:
+            fields = line.split()
+            if not fields or fields[0].startswith("#"):
+                continue
+            baseline[(fields[0], fields[1])] = dict(zip(METRICS, (int(value) for value in fields[2:])))
+    return baseline
+
+
+def save_baseline(results):
+    with open(BASELINE, "w") as f:
+        f.write("# Port driver register traffic recorded by tools/Port_Bench.py --update\n")
+        f.write("# %-10s %-26s %6s %6s %6s %7s\n" % (("scenario", "api") + METRICS))
+        for (scenario, api), values in results.items():
+            f.write("  %-10s %-26s %6d %6d %6d %7d\n" % ((scenario, api) + tuple(values[m] for m in METRICS)))
+    print("%s: updated" % BASELINE)
+
+
+def compare(results, baseline):
+    """Print the comparison table, return the list of regressions."""
+    regressions = []
+    print("%-10s %-26s %6s %6s %6s %7s   baseline r/w/cycles" % (("scenario", "api") + METRICS))
+    for key, values in results.items():
+        base = baseline.get(key)
+        reference = "-" if base is None else "%d/%d/%d" % (base["reads"], base["writes"], base["cycles"])
+        print("%-10s %-26s %6d %6d %6d %7d   %s" % (key + tuple(values[m] for m in METRICS) + (reference,)))
+        if base is None:
+            regressions.append("%s %s: no baseline" % key)
+            continue
+        if base["calls"] != values["calls"]:
+            regressions.append("%s %s: %d calls, the baseline has %d" % (key + (values["calls"], base["calls"])))
+        for metric in METRICS[1:]:
+            if values[metric] > base[metric]:
+                regressions.append("%s %s: %s %d > %d" % (key + (metric, values[metric], base[metric])))
+    return regressions
+
+
+def main(argv):
+    update = "--update" in argv
+    cc = next((arg.split("=", 1)[1] for arg in argv if arg.startswith("--cc=")), "gcc")
+    defines = [arg for arg in argv if arg.startswith("-D")]
+    try:
+        results = {}
+        with tempfile.TemporaryDirectory() as workdir:
+            for name, config, pins in SCENARIOS:
+                for api, values in run_scenario(name, config, pins, cc, defines, workdir).items():
+                    results[(name, api)] = values
+        if update:
+            save_baseline(results)
+            return 0
+        regressions = compare(results, load_baseline())
+    except (BenchError, OSError) as error:
+        print("Port_Bench: %s" % error, file=sys.stderr)
+        return 2
+    for regression in regressions:
+        print("REGRESSION %s" % regression, file=sys.stderr)
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,198 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Bench_Sparse.c
+ *
+ * Description: Launchpad style configuration using only two ports: the user switches
+ *              and LEDs of port F and one ADC input.
+ *              Benchmark configuration of tools/Port_Bench.py, 6 configured pins.
+ *
+ * Author: Ahmed Wael
+ ******************************************************************************/
+
+#include "Port.h"
+#include "Port_Regs.h"
+
+const Port_ConfigType Port_PinConfiguration = 
+{
+  {  PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN3, PORT_PIN_IN, No_Change, PORT_PIN_MODE_ADC, No_Change, STD_LOW, PORT_PIN_OFF),
+     
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_LOW, PORT_PIN_PUN),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN1, PORT_PIN_OUT, No_Change, PORT_PIN_MODE_GPIO, Change, STD_LOW, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN2, PORT_PIN_OUT, No_Change, PORT_PIN_MODE_GPIO, Change, STD_LOW, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN3, PORT_PIN_OUT, No_Change, PORT_PIN_MODE_GPIO, Change, STD_LOW, PORT_PIN_OFF),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_LOW, PORT_PIN_PUN) },
+  
+/* Port_Generator begin: Port_PinConfiguration */
+  /* Generated by tools/Port_Generator.py - do not edit */
+  /* Port register images { Mask, Pctl_Mask, Commit, Amsel, Den, Afsel, Pctl, Dir, Dir_Locked, Data, Pur, Pdr, Mode_Locked, Pctl_Locked } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000008U, 0x0000F000U, 0x00000000U, 0x00000008U, 0x00000000U, 0x00000008U, 0x00000000U, 0x00000000U, 0x00000008U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000008U, 0x0000F000U },  /* PORTE */
+    { 0x0000001FU, 0x000FFFFFU, 0x00000001U, 0x00000000U, 0x0000001FU, 0x00000000U, 0x00000000U, 0x0000000EU, 0x0000000EU, 0x00000000U, 0x00000011U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Pin register access data { Mask, Pctl_Shift } */
+  {
+    { 0x08U, 12U },  /* PE3 */
+    { 0x01U, 0U },  /* PF0 */
+    { 0x02U, 4U },  /* PF1 */
+    { 0x04U, 8U },  /* PF2 */
+    { 0x08U, 12U },  /* PF3 */
+    { 0x10U, 16U }   /* PF4 */
+  },
+  /* Port group addresses { Data_Address } */
+  {
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 0x00U) },  /* PORTA */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 0x00U) },  /* PORTB */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 0x00U) },  /* PORTC */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 0x00U) },  /* PORTD */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 0x08U) },  /* PORTE */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 0x1FU) }   /* PORTF */
+  },
+  /* Clock_Mask */
+  0x00000030U,
+  /* Critical pins of every port { PORTA, PORTB, PORTC, PORTD, PORTE, PORTF } */
+  { 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U },
+  /* Pin interrupt images { Im, Is, Ibe, Iev } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Debounce images { Mask, Reload0, Reload1, Reload2 } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Sleep images { Mask, Amsel, Afsel, Pur, Pdr, Data, Dir, Den, Data_Address } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 0x00U) },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 0x00U) },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 0x00U) },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 0x00U) },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 0x00U) },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 0x00U) }   /* PORTF */
+  }
+/* Port_Generator end: Port_PinConfiguration */
+};
+
+/* Low power run mode of the scenario: LEDs turned into pulled-down inputs */
+const Port_ConfigType Port_LowPowerConfiguration = 
+{
+  {  PORT_PIN_CONFIG(PORT_PORTE, PORT_PIN3, PORT_PIN_IN, No_Change, PORT_PIN_MODE_ADC, No_Change, STD_LOW, PORT_PIN_OFF),
+     
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN0, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_LOW, PORT_PIN_PUN),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN1, PORT_PIN_IN, No_Change, PORT_PIN_MODE_GPIO, Change, STD_LOW, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN2, PORT_PIN_IN, No_Change, PORT_PIN_MODE_GPIO, Change, STD_LOW, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN3, PORT_PIN_IN, No_Change, PORT_PIN_MODE_GPIO, Change, STD_LOW, PORT_PIN_PDN),
+     PORT_PIN_CONFIG(PORT_PORTF, PORT_PIN4, PORT_PIN_IN, Change, PORT_PIN_MODE_GPIO, Change, STD_LOW, PORT_PIN_PUN) },
+  
+/* Port_Generator begin: Port_LowPowerConfiguration */
+  /* Generated by tools/Port_Generator.py - do not edit */
+  /* Port register images { Mask, Pctl_Mask, Commit, Amsel, Den, Afsel, Pctl, Dir, Dir_Locked, Data, Pur, Pdr, Mode_Locked, Pctl_Locked } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000008U, 0x0000F000U, 0x00000000U, 0x00000008U, 0x00000000U, 0x00000008U, 0x00000000U, 0x00000000U, 0x00000008U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000008U, 0x0000F000U },  /* PORTE */
+    { 0x0000001FU, 0x000FFFFFU, 0x00000001U, 0x00000000U, 0x0000001FU, 0x00000000U, 0x00000000U, 0x00000000U, 0x0000000EU, 0x00000000U, 0x00000011U, 0x0000000EU, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Pin register access data { Mask, Pctl_Shift } */
+  {
+    { 0x08U, 12U },  /* PE3 */
+    { 0x01U, 0U },  /* PF0 */
+    { 0x02U, 4U },  /* PF1 */
+    { 0x04U, 8U },  /* PF2 */
+    { 0x08U, 12U },  /* PF3 */
+    { 0x10U, 16U }   /* PF4 */
+  },
+  /* Port group addresses { Data_Address } */
+  {
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 0x00U) },  /* PORTA */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 0x00U) },  /* PORTB */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 0x00U) },  /* PORTC */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 0x00U) },  /* PORTD */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 0x08U) },  /* PORTE */
+    { PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 0x1FU) }   /* PORTF */
+  },
+  /* Clock_Mask */
+  0x00000030U,
+  /* Critical pins of every port { PORTA, PORTB, PORTC, PORTD, PORTE, PORTF } */
+  { 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U },
+  /* Pin interrupt images { Im, Is, Ibe, Iev } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Debounce images { Mask, Reload0, Reload1, Reload2 } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }   /* PORTF */
+  },
+  /* Sleep images { Mask, Amsel, Afsel, Pur, Pdr, Data, Dir, Den, Data_Address } */
+  {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 0x00U) },  /* PORTA */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 0x00U) },  /* PORTB */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 0x00U) },  /* PORTC */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 0x00U) },  /* PORTD */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 0x00U) },  /* PORTE */
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 0x00U) }   /* PORTF */
+  }
+/* Port_Generator end: Port_LowPowerConfiguration */
+};
+
+/* No pin is armed in this scenario */
+const Port_PinNotificationType Port_PinNotifications[PORT_NUMBER_OF_PORTS][PORT_PINS_PER_PORT] =
+{
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR },  /* PORTA */
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR },  /* PORTB */
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR },  /* PORTC */
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR },  /* PORTD */
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR },  /* PORTE */
+  { NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR }   /* PORTF */
+};
+
+/* Port_Generator begin: Port_ConfigSwitches */
+  /* Generated by tools/Port_Generator.py - do not edit */
+/* Port_PinConfiguration -> Port_LowPowerConfiguration { Mask, Value, Offset, Port_Num } */
+STATIC const Port_RegDeltaType Port_PinConfiguration_To_LowPowerConfiguration[2] =
+{
+  { 0x0000000EU, 0x0000000EU, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTF },
+  { 0x0000000EU, 0x00000000U, PORT_DIR_REG_OFFSET, PORT_PORTF }
+};
+
+/* Port_LowPowerConfiguration -> Port_PinConfiguration { Mask, Value, Offset, Port_Num } */
+STATIC const Port_RegDeltaType Port_LowPowerConfiguration_To_PinConfiguration[2] =
+{
+  { 0x0000000EU, 0x00000000U, PORT_PULL_DOWN_REG_OFFSET, PORT_PORTF },
+  { 0x0000000EU, 0x0000000EU, PORT_DIR_REG_OFFSET, PORT_PORTF }
+};
+
+/* Precomputed switches between the configuration sets { From, To, Delta, Count } */
+const Port_ConfigSwitchType Port_ConfigSwitches[3] =
+{
+  { &Port_PinConfiguration, &Port_LowPowerConfiguration, Port_PinConfiguration_To_LowPowerConfiguration, 2U },
+  { &Port_LowPowerConfiguration, &Port_PinConfiguration, Port_LowPowerConfiguration_To_PinConfiguration, 2U },
+  { NULL_PTR, NULL_PTR, NULL_PTR, 0U }
+};
+/* Port_Generator end: Port_ConfigSwitches */
@@ -0,0 +1,722 @@
+#!/usr/bin/env python3
+"""
+ Module: Port
+
+ File Name: Port_Generator.py
+
+ Description: Host side generator for the TM4C123GH6PM Port Driver post build
+              configuration. It reads every Port_ConfigType pin table of
+              Port_PBcfg.c and emits the ready-to-write register images of each
+              port into the generated region of the same configuration set.
+              It also turns the pin multiplexing database tools/Port_PinMux.csv
+              into the Port_PinMux table of Port_PinMux.c, and rejects pin
+              tables selecting a mode their pin does not support. The register
+              updates switching between the configuration sets of a file are
+              emitted into its Port_ConfigSwitches region.
+
+ Usage: python3 tools/Port_Generator.py [--check] [--size] [-DNAME=VALUE ...] [Port_PBcfg.c ...]
+        --check  do not write anything, fail if a generated region is stale or
+                 if the images do not decode back into the pin table.
+        --size   print the flash footprint of every Port_ConfigType member and
+                 the total of every configuration file against the original
+                 driver.
+        -D       override a configuration symbol the way the compiler option
+                 does, e.g. -DPORT_CONFIGURED_PINS=6 for a smaller pin table.
+"""
+
+import os
+import re
+import sys
+
+REPO_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+NUMBER_OF_PORTS = 6
+PORT_NAMES = "ABCDEF"
+
+# Field order of Port_PortImage in Port.h
+IMAGE_FIELDS = ("Mask", "Pctl_Mask", "Commit", "Amsel", "Den", "Afsel",
+                "Pctl", "Dir", "Dir_Locked", "Data", "Pur", "Pdr", "Mode_Locked", "Pctl_Locked")
+
+# Pins whose AFSEL, PUR, PDR and DEN bits are locked until committed in GPIOCR
+LOCKED_PINS = {2: 0x0F,     # PC0 to PC3, JTAG/SWD
+               3: 0x80,     # PD7, NMI
+               5: 0x01}     # PF0, NMI
+
+# JTAG/SWD pins handled according to PORT_JTAG_PINS_POLICY
+JTAG_PINS = {2: 0x0F}
+
+PIN_FIELDS = ("Port_Num", "Pin_Num", "Direction", "Pin_Change_Direction",
+              "Pin_Mode", "Pin_Change_Mode", "Init_Value", "Pull_Resistor")
+
+# Optional attributes OR-ed to PORT_PIN_CONFIG, decoded with the PORT_PIN_CFG_<symbol>_SHIFT/MASK of Port.h
+ATTRIBUTE_FIELDS = (("Priority", "PRIORITY"), ("Interrupt", "INTERRUPT"), ("Debounce", "DEBOUNCE"), ("Sleep", "SLEEP"))
+
+# Field order of Port_IrqImageType in Port.h
+IRQ_FIELDS = ("Im", "Is", "Ibe", "Iev")
+
+# Register bits of every PORT_PIN_IRQ_* attribute of Port.h: (Is, Ibe, Iev)
+IRQ_SENSES = {"PORT_PIN_IRQ_FALLING_EDGE": (0, 0, 0),
+              "PORT_PIN_IRQ_RISING_EDGE": (0, 0, 1),
+              "PORT_PIN_IRQ_BOTH_EDGES": (0, 1, 0),
+              "PORT_PIN_IRQ_LOW_LEVEL": (1, 0, 0),
+              "PORT_PIN_IRQ_HIGH_LEVEL": (1, 0, 1)}
+
+# Field order of Port_DebounceImageType in Port.h, the reload planes hold bit k of the per pin sample count
+DEBOUNCE_FIELDS = ("Mask", "Reload0", "Reload1", "Reload2")
+
+# Field order of Port_SleepImageType in Port.h
+SLEEP_FIELDS = ("Mask", "Amsel", "Afsel", "Pur", "Pdr", "Data", "Dir", "Den", "Data_Address")
+
+# Register bits of every PORT_PIN_SLEEP_* attribute of Port.h: (Pur, Pdr, Data, Dir, Den), always GPIO
+SLEEP_STATES = {"PORT_PIN_SLEEP_DISABLED": (0, 0, 0, 0, 0),
+                "PORT_PIN_SLEEP_PULL_DOWN": (0, 1, 0, 0, 1),
+                "PORT_PIN_SLEEP_PULL_UP": (1, 0, 0, 0, 1),
+                "PORT_PIN_SLEEP_OUT_LOW": (0, 0, 0, 1, 1),
+                "PORT_PIN_SLEEP_OUT_HIGH": (0, 0, 1, 1, 1)}
+
+# Field order of Port_PinDescType in Port.h
+PIN_DESC_FIELDS = ("Mask", "Pctl_Shift")
+
+# Field order of Port_GroupType in Port.h
+GROUP_FIELDS = ("Data_Address",)
+
+# Registers updated by a configuration switch, in the Port_Init order: (image field, offset, mask field)
+SWITCH_REGISTERS = (("Amsel", "PORT_ANALOG_MODE_SEL_REG_OFFSET", "Mask"),
+                    ("Afsel", "PORT_ALT_FUNC_REG_OFFSET", "Mask"),
+                    ("Pctl", "PORT_CTL_REG_OFFSET", "Pctl_Mask"),
+                    ("Pur", "PORT_PULL_UP_REG_OFFSET", "Mask"),
+                    ("Pdr", "PORT_PULL_DOWN_REG_OFFSET", "Mask"),
+                    ("Data", None, "Mask"),
+                    ("Dir", "PORT_DIR_REG_OFFSET", "Mask"),
+                    ("Den", "PORT_DIGITAL_ENABLE_REG_OFFSET", "Mask"))
+
+# Interrupt sense registers updated by a configuration switch, the pins changing sense are disarmed around them
+SWITCH_IRQ_REGISTERS = (("Is", "PORT_INT_SENSE_REG_OFFSET"),
+                        ("Ibe", "PORT_INT_BOTH_EDGES_REG_OFFSET"),
+                        ("Iev", "PORT_INT_EVENT_REG_OFFSET"))
+SWITCHES_REGION = "Port_ConfigSwitches"
+
+# Pin_Config of the original driver: two uint8 fields and six int sized enums, one configuration set
+ORIGINAL_PIN_CONFIG_SIZE = 28
+
+# Data and function pointers on the Cortex-M4
+POINTER_SIZE = 4
+
+PINMUX_CSV = os.path.join(REPO_DIR, "tools", "Port_PinMux.csv")
+PINMUX_SOURCE = os.path.join(REPO_DIR, "Port_PinMux.c")
+PINMUX_ENTRY_BITS = 5
+PINMUX_VALID = 0x10
+PINS_PER_PORT = 8
+
+BEGIN_MARK = "/* Port_Generator begin: %s */"
+END_MARK = "/* Port_Generator end: %s */"
+
+
+class GeneratorError(Exception):
+    pass
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", " ", text, flags=re.S)
+    return re.sub(r"//[^\n]*", " ", text)
+
+
+def load_symbols(*headers):
+    """Collect the numeric value of every #define and enumerator of the headers."""
+    symbols = {}
+    aliases = []
+    for header in headers:
+        with open(os.path.join(REPO_DIR, header)) as f:
+            text = strip_comments(f.read())
+        for name, value in re.findall(r"#define\s+(\w+)\s+\(?\s*(0x[0-9A-Fa-f]+|\d+)[uUlL]*\s*\)?\s*$",
+                                      text, flags=re.M):
+            symbols[name] = int(value, 0)
+        aliases += re.findall(r"#define\s+(\w+)\s+\(?\s*([A-Za-z_]\w*)\s*\)?\s*$", text, flags=re.M)
+        for body in re.findall(r"typedef\s+enum\s*\{(.*?)\}", text, flags=re.S):
+            value = 0
+            for item in body.split(","):
+                item = item.strip()
+                if not item:
+                    continue
+                if "=" in item:
+                    item, expr = (part.strip() for part in item.split("="))
+                    value = int(expr.rstrip("uU"), 0)
+                symbols[item] = value
+                value += 1
+    for name, target in aliases:
+        if target in symbols:
+            symbols[name] = symbols[target]
+    return symbols
+
+
+def evaluate(token, symbols):
+    token = token.strip().strip("()").strip()
+    if token in symbols:
+        return symbols[token]
+    try:
+        return int(token.rstrip("uU"), 0)
+    except ValueError:
+        raise GeneratorError("unknown symbol '%s' in pin table" % token)
+
+
+def matching_brace(text, start):
+    depth = 0
+    for idx in range(start, len(text)):
+        if text[idx] == "{":
+            depth += 1
+        elif text[idx] == "}":
+            depth -= 1
+            if depth == 0:
+                return idx
+    raise GeneratorError("unbalanced braces")
+
+
+def parse_config_sets(text, symbols):
+    """Return [(name, [pin dict, ...])] for every Port_ConfigType definition."""
+    sets = []
+    for match in re.finditer(r"const\s+Port_ConfigType\s+(\w+)\s*=\s*\{", text):
+        name = match.group(1)
+        pins_start = text.index("{", match.end())
+        pins_text = strip_comments(text[pins_start + 1:matching_brace(text, pins_start)])
+        pins = []
+        for row, extra in re.findall(r"PORT_PIN_CONFIG\s*\(([^)]*)\)((?:\s*\|\s*\w+)*)", pins_text):
+            tokens = row.split(",")
+            if len(tokens) != len(PIN_FIELDS):
+                raise GeneratorError("%s: PORT_PIN_CONFIG(%s) does not have %d fields" % (name, row, len(PIN_FIELDS)))
+            pin = dict(zip(PIN_FIELDS, (evaluate(t, symbols) for t in tokens)))
+            attributes = 0
+            for term in re.findall(r"\w+", extra):
+                attributes |= evaluate(term, symbols)
+            for field, symbol in ATTRIBUTE_FIELDS:
+                pin[field] = (attributes >> symbols["PORT_PIN_CFG_%s_SHIFT" % symbol]) & symbols["PORT_PIN_CFG_%s_MASK" % symbol]
+            pins.append(pin)
+        if len(pins) != symbols["PORT_CONFIGURED_PINS"]:
+            raise GeneratorError("%s: %d pins configured, PORT_CONFIGURED_PINS is %d"
+                                 % (name, len(pins), symbols["PORT_CONFIGURED_PINS"]))
+        sets.append((name, pins))
+    return sets
+
+
+def load_pinmux(symbols):
+    """Return {(port, pin): {mode: (pctl, function)}} from the pin multiplexing database."""
+    mux = {}
+    with open(PINMUX_CSV) as f:
+        rows = [line.strip() for line in f if line.strip() and not line.startswith("#")]
+    for number, row in enumerate(rows[1:], 2):
+        fields = [field.strip() for field in row.split(",")]
+        if len(fields) != 5:
+            raise GeneratorError("%s: row %d does not have 5 fields" % (PINMUX_CSV, number))
+        port, pin, mode, pctl, function = fields
+        mode_symbol = "PORT_PIN_MODE_" + mode
+        if port not in PORT_NAMES or not pin.isdigit() or int(pin) >= PINS_PER_PORT:
+            raise GeneratorError("%s: row %d, unknown pin P%s%s" % (PINMUX_CSV, number, port, pin))
+        if mode_symbol not in symbols or not 0 <= int(pctl, 0) <= 0xF:
+            raise GeneratorError("%s: row %d, unknown mode %s or PMCx %s" % (PINMUX_CSV, number, mode, pctl))
+        modes = mux.setdefault((PORT_NAMES.index(port), int(pin)), {})
+        if symbols[mode_symbol] in modes:
+            raise GeneratorError("%s: row %d, P%s%s %s listed twice" % (PINMUX_CSV, number, port, pin, mode))
+        modes[symbols[mode_symbol]] = (int(pctl, 0), function)
+    return mux
+
+
+def render_pinmux(mux, symbols):
+    mode_names = {value: name[len("PORT_PIN_MODE_"):] for name, value in symbols.items()
+                  if name.startswith("PORT_PIN_MODE_")}
+    lines = [BEGIN_MARK % "Port_PinMux",
+             "  /* Generated by tools/Port_Generator.py from tools/Port_PinMux.csv - do not edit */"]
+    for port in range(NUMBER_OF_PORTS):
+        lines.append("  {")
+        for pin in range(PINS_PER_PORT):
+            modes = mux.get((port, pin), {})
+            word = 0
+            for mode, (pctl, _) in modes.items():
+                word |= (PINMUX_VALID | pctl) << (mode * PINMUX_ENTRY_BITS)
+            label = " ".join("%s:%s" % (mode_names[mode], function) for mode, (_, function) in sorted(modes.items()))
+            lines.append("    0x%016XULL%s  /* P%s%d %s */" % (word, "," if pin < PINS_PER_PORT - 1 else " ",
+                                                            PORT_NAMES[port], pin, label or "not bonded"))
+        lines.append("  }%s" % ("," if port < NUMBER_OF_PORTS - 1 else ""))
+    lines.append(END_MARK % "Port_PinMux")
+    return "\n".join(lines)
+
+
+def replace_region(text, name, generated, path):
+    begin = text.find(BEGIN_MARK % name)
+    end = text.find(END_MARK % name)
+    if begin < 0 or end < 0:
+        raise GeneratorError("%s: generated region of %s is missing" % (path, name))
+    return text[:begin] + generated + text[end + len(END_MARK % name):]
+
+
+def write_if_changed(path, text, new_text, check):
+    if new_text == text:
+        return True
+    if check:
+        print("%s: generated region is out of date, run tools/Port_Generator.py" % path, file=sys.stderr)
+        return False
+    with open(path, "w") as f:
+        f.write(new_text)
+    print("%s: regenerated" % path)
+    return True
+
+
+def generate_pinmux(check, symbols, mux):
+    with open(PINMUX_SOURCE) as f:
+        text = f.read()
+    new_text = replace_region(text, "Port_PinMux", render_pinmux(mux, symbols), PINMUX_SOURCE)
+    return write_if_changed(PINMUX_SOURCE, text, new_text, check)
+
+
+def is_locked_pin(pin):
+    return bool(LOCKED_PINS.get(pin["Port_Num"], 0) & (1 << pin["Pin_Num"]))
+
+
+def is_protected_pin(pin, symbols):
+    """JTAG pins are left out of the images unless the policy makes them configurable."""
+    return (bool(JTAG_PINS.get(pin["Port_Num"], 0) & (1 << pin["Pin_Num"]))
+            and symbols["PORT_JTAG_PINS_POLICY"] != symbols["PORT_JTAG_PINS_CONFIGURABLE"])
+
+
+def pin_label(pin):
+    return "P%s%d" % (PORT_NAMES[pin["Port_Num"]], pin["Pin_Num"])
+
+
+def pin_pctl(pin, mux):
+    """PMCx value of the pin mode, None if the pin does not support it."""
+    entry = mux.get((pin["Port_Num"], pin["Pin_Num"]), {}).get(pin["Pin_Mode"])
+    return None if entry is None else entry[0]
+
+
+def irq_sense(pin, symbols):
+    """(Is, Ibe, Iev) bits of the pin interrupt attribute, None if the pin is not armed."""
+    if not pin["Interrupt"]:
+        return None
+    for symbol, sense in IRQ_SENSES.items():
+        if pin["Interrupt"] == symbols[symbol] >> symbols["PORT_PIN_CFG_INTERRUPT_SHIFT"]:
+            return sense
+    raise GeneratorError("%s: unknown interrupt attribute %d" % (pin_label(pin), pin["Interrupt"]))
+
+
+def build_images(name, pins, symbols, mux):
+    """Decode the pin table exactly the way the Port driver configures the pins."""
+    images = [dict.fromkeys(IMAGE_FIELDS + IRQ_FIELDS, 0) for _ in range(NUMBER_OF_PORTS)]
+    for pin in pins:
+        if is_protected_pin(pin, symbols):
+            continue
+        if pin_pctl(pin, mux) is None:
+            raise GeneratorError("%s: %s does not support mode %d (tools/Port_PinMux.csv)"
+                                 % (name, pin_label(pin), pin["Pin_Mode"]))
+        image = images[pin["Port_Num"]]
+        bit = 1 << pin["Pin_Num"]
+        pctl = 0xF << (pin["Pin_Num"] * 4)
+        if is_locked_pin(pin):
+            image["Commit"] |= bit
+        image["Mask"] |= bit
+        image["Pctl_Mask"] |= pctl
+
+        mode = pin["Pin_Mode"]
+        image["Pctl"] |= pin_pctl(pin, mux) << (pin["Pin_Num"] * 4)
+        if mode == symbols["PORT_PIN_MODE_ADC"]:
+            image["Amsel"] |= bit
+            image["Afsel"] |= bit
+        elif symbols["PORT_PIN_MODE_ALT1"] <= mode <= symbols["PORT_PIN_MODE_ALT9"]:
+            image["Den"] |= bit
+            image["Afsel"] |= bit
+        else:
+            image["Den"] |= bit
+
+        if pin["Pin_Change_Direction"] == symbols["No_Change"]:
+            image["Dir_Locked"] |= bit
+        if pin["Pin_Change_Mode"] == symbols["No_Change"]:
+            image["Mode_Locked"] |= bit
+            image["Pctl_Locked"] |= pctl
+
+        if pin["Direction"] == symbols["PORT_PIN_OUT"]:
+            image["Dir"] |= bit
+            if pin["Init_Value"] == symbols["STD_HIGH"]:
+                image["Data"] |= bit
+        elif pin["Pull_Resistor"] == symbols["PORT_PIN_PUN"]:
+            image["Pur"] |= bit
+        elif pin["Pull_Resistor"] == symbols["PORT_PIN_PDN"]:
+            image["Pdr"] |= bit
+
+        sense = irq_sense(pin, symbols)
+        if sense is not None:
+            image["Im"] |= bit
+            for field, value in zip(IRQ_FIELDS[1:], sense):
+                image[field] |= bit if value else 0
+    return images
+
+
+def build_debounce(name, pins, symbols):
+    """Per port debounced pins and bit-sliced reload values of their sample counters."""
+    debounce = [dict.fromkeys(DEBOUNCE_FIELDS, 0) for _ in range(NUMBER_OF_PORTS)]
+    for pin in pins:
+        if not pin["Debounce"] or is_protected_pin(pin, symbols):
+            continue
+        if pin["Pin_Mode"] == symbols["PORT_PIN_MODE_ADC"]:
+            raise GeneratorError("%s: %s is debounced but has no digital input" % (name, pin_label(pin)))
+        image = debounce[pin["Port_Num"]]
+        bit = 1 << pin["Pin_Num"]
+        image["Mask"] |= bit
+        for plane, field in enumerate(DEBOUNCE_FIELDS[1:]):
+            image[field] |= bit if pin["Debounce"] & (1 << plane) else 0
+    return debounce
+
+
+def verify_debounce(name, pins, images, debounce, symbols):
+    """Decode the sample count of every pin back from the bit planes."""
+    errors = []
+    for pin in pins:
+        if is_protected_pin(pin, symbols):
+            continue
+        image = debounce[pin["Port_Num"]]
+        bit = 1 << pin["Pin_Num"]
+        count = sum(1 << plane for plane, field in enumerate(DEBOUNCE_FIELDS[1:]) if image[field] & bit)
+        if bool(image["Mask"] & bit) != bool(pin["Debounce"]) or count != pin["Debounce"]:
+            errors.append("%s: %s debounce mismatch" % (name, pin_label(pin)))
+    for port, image in enumerate(debounce):
+        if any(image[field] & ~image["Mask"] for field in DEBOUNCE_FIELDS[1:]) or image["Mask"] & ~images[port]["Mask"]:
+            errors.append("%s: PORT%s debounce image touches pins outside the debounced ones"
+                          % (name, PORT_NAMES[port]))
+    return errors
+
+
+def sleep_state(pin, symbols):
+    """(Pur, Pdr, Data, Dir, Den) bits of the pin sleep attribute, None if the pin keeps its state."""
+    if not pin["Sleep"]:
+        return None
+    for symbol, state in SLEEP_STATES.items():
+        if pin["Sleep"] == symbols[symbol] >> symbols["PORT_PIN_CFG_SLEEP_SHIFT"]:
+            return state
+    raise GeneratorError("%s: unknown sleep attribute %d" % (pin_label(pin), pin["Sleep"]))
+
+
+def build_sleep(name, pins, symbols):
+    """Per port low power images of the pins with a sleep attribute."""
+    sleep = [dict.fromkeys(SLEEP_FIELDS[:-1], 0) for _ in range(NUMBER_OF_PORTS)]
+    for pin in pins:
+        state = sleep_state(pin, symbols)
+        if state is None or is_protected_pin(pin, symbols):
+            continue
+        if pin["Interrupt"]:
+            raise GeneratorError("%s: %s is armed, a wake up pin cannot have a sleep attribute" % (name, pin_label(pin)))
+        image = sleep[pin["Port_Num"]]
+        bit = 1 << pin["Pin_Num"]
+        image["Mask"] |= bit
+        for field, value in zip(SLEEP_FIELDS[3:-1], state):
+            image[field] |= bit if value else 0
+    for port, image in enumerate(sleep):
+        image["Data_Address"] = "PORT_DATA_MASKED_ADDRESS(GPIO_PORT%s_BASE_ADDRESS, 0x%02XU)" % (PORT_NAMES[port], image["Mask"])
+    return sleep
+
+
+def verify_sleep(name, pins, images, sleep, symbols):
+    """Decode the low power state of every pin back from the sleep images."""
+    errors = []
+    for pin in pins:
+        if is_protected_pin(pin, symbols):
+            continue
+        image = sleep[pin["Port_Num"]]
+        bit = 1 << pin["Pin_Num"]
+        state = tuple(int(bool(image[field] & bit)) for field in SLEEP_FIELDS[3:-1])
+        if (bool(image["Mask"] & bit), state if image["Mask"] & bit else None) != \
+                (pin["Sleep"] != 0, sleep_state(pin, symbols)) or image["Amsel"] & bit or image["Afsel"] & bit:
+            errors.append("%s: %s sleep state mismatch" % (name, pin_label(pin)))
+    for port, image in enumerate(sleep):
+        if any(image[field] & ~image["Mask"] for field in SLEEP_FIELDS[1:-1]) or image["Mask"] & ~images[port]["Mask"]:
+            errors.append("%s: PORT%s sleep image touches pins outside the sleeping ones" % (name, PORT_NAMES[port]))
+    return errors
+
+
+def verify_images(name, pins, images, symbols, mux):
+    """Decode the images back per pin and compare them with the pin table."""
+    errors = []
+    for pin in pins:
+        if is_protected_pin(pin, symbols):
+            continue
+        image = images[pin["Port_Num"]]
+        bit = 1 << pin["Pin_Num"]
+        label = "%s: P%s%d" % (name, PORT_NAMES[pin["Port_Num"]], pin["Pin_Num"])
+        if not image["Mask"] & bit:
+            errors.append("%s is not owned by its port image" % label)
+        if bool(image["Dir"] & bit) != (pin["Direction"] == symbols["PORT_PIN_OUT"]):
+            errors.append("%s direction mismatch" % label)
+        if bool(image["Dir_Locked"] & bit) != (pin["Pin_Change_Direction"] == symbols["No_Change"]):
+            errors.append("%s direction lock mismatch" % label)
+        digital = pin["Pin_Mode"] != symbols["PORT_PIN_MODE_ADC"]
+        if bool(image["Den"] & bit) != digital or bool(image["Amsel"] & bit) == digital:
+            errors.append("%s analog/digital mismatch" % label)
+        if bool(image["Afsel"] & bit) != (pin["Pin_Mode"] != symbols["PORT_PIN_MODE_GPIO"]):
+            errors.append("%s alternate function mismatch" % label)
+        if bool(image["Commit"] & bit) != is_locked_pin(pin):
+            errors.append("%s commit mismatch" % label)
+        if (image["Pctl"] >> (pin["Pin_Num"] * 4)) & 0xF != pin_pctl(pin, mux):
+            errors.append("%s PMCx mismatch" % label)
+        if bool(image["Mode_Locked"] & bit) != (pin["Pin_Change_Mode"] == symbols["No_Change"]):
+            errors.append("%s mode lock mismatch" % label)
+        if image["Pur"] & image["Pdr"] & bit:
+            errors.append("%s has both pull resistors enabled" % label)
+        sense = tuple(int(bool(image[field] & bit)) for field in IRQ_FIELDS[1:])
+        if (bool(image["Im"] & bit), sense if image["Im"] & bit else None) != \
+                (pin["Interrupt"] != 0, irq_sense(pin, symbols)):
+            errors.append("%s interrupt mismatch" % label)
+    for port, image in enumerate(images):
+        for field in IMAGE_FIELDS[2:] + IRQ_FIELDS:
+            owner = image["Pctl_Mask"] if field in ("Pctl", "Pctl_Locked") else image["Mask"]
+            if image[field] & ~owner:
+                errors.append("%s: PORT%s %s touches pins outside the configuration"
+                              % (name, PORT_NAMES[port], field))
+    return errors
+
+
+def build_pin_descs(pins):
+    """Per pin register access data, the pin addresses are derived from the port base address at runtime."""
+    descs = []
+    for pin in pins:
+        descs.append({
+            "Mask": "0x%02XU" % (1 << pin["Pin_Num"]),
+            "Pctl_Shift": "%dU" % (pin["Pin_Num"] * 4),
+        })
+    return descs
+
+
+def build_critical(pins, images):
+    """Per port mask of the PORT_PIN_CRITICAL pins, Port_EarlyInit takes their bits from the port images."""
+    critical = [0] * NUMBER_OF_PORTS
+    for pin in pins:
+        if pin["Priority"]:
+            critical[pin["Port_Num"]] |= 1 << pin["Pin_Num"]
+    return [mask & image["Mask"] for mask, image in zip(critical, images)]
+
+
+def build_groups(images):
+    """Per port GPIODATA address masked to the configured pins of the port."""
+    return [{"Data_Address": "PORT_DATA_MASKED_ADDRESS(GPIO_PORT%s_BASE_ADDRESS, 0x%02XU)"
+                             % (PORT_NAMES[port], image["Mask"])}
+            for port, image in enumerate(images)]
+
+
+def render_table(rows, fields, labels):
+    lines = ["  {"]
+    for idx, row in enumerate(rows):
+        values = ", ".join(row[field] if isinstance(row[field], str) else "0x%08XU" % row[field]
+                           for field in fields)
+        lines.append("    { %s }%s  /* %s */" % (values, "," if idx < len(rows) - 1 else " ", labels[idx]))
+    lines.append("  }")
+    return lines
+
+
+def render(name, pins, images, descs, groups, critical, debounce, sleep):
+    lines = [BEGIN_MARK % name,
+             "  /* Generated by tools/Port_Generator.py - do not edit */",
+             "  /* Port register images { " + ", ".join(IMAGE_FIELDS) + " } */"]
+    lines += render_table(images, IMAGE_FIELDS, ["PORT%s" % PORT_NAMES[port] for port in range(NUMBER_OF_PORTS)])
+    lines[-1] += ","
+    lines.append("  /* Pin register access data { " + ", ".join(PIN_DESC_FIELDS) + " } */")
+    lines += render_table(descs, PIN_DESC_FIELDS,
+                          ["P%s%d" % (PORT_NAMES[pin["Port_Num"]], pin["Pin_Num"]) for pin in pins])
+    lines[-1] += ","
+    lines.append("  /* Port group addresses { " + ", ".join(GROUP_FIELDS) + " } */")
+    lines += render_table(groups, GROUP_FIELDS, ["PORT%s" % PORT_NAMES[port] for port in range(NUMBER_OF_PORTS)])
+    lines[-1] += ","
+    clock_mask = sum(1 << port for port, image in enumerate(images) if image["Mask"])
+    lines.append("  /* Clock_Mask */")
+    lines.append("  0x%08XU," % clock_mask)
+    lines.append("  /* Critical pins of every port { " + ", ".join("PORT%s" % name for name in PORT_NAMES) + " } */")
+    lines.append("  { " + ", ".join("0x%02XU" % mask for mask in critical) + " },")
+    lines.append("  /* Pin interrupt images { " + ", ".join(IRQ_FIELDS) + " } */")
+    lines += render_table(images, IRQ_FIELDS, ["PORT%s" % PORT_NAMES[port] for port in range(NUMBER_OF_PORTS)])
+    lines[-1] += ","
+    lines.append("  /* Debounce images { " + ", ".join(DEBOUNCE_FIELDS) + " } */")
+    lines += render_table(debounce, DEBOUNCE_FIELDS, ["PORT%s" % PORT_NAMES[port] for port in range(NUMBER_OF_PORTS)])
+    lines[-1] += ","
+    lines.append("  /* Sleep images { " + ", ".join(SLEEP_FIELDS) + " } */")
+    lines += render_table(sleep, SLEEP_FIELDS, ["PORT%s" % PORT_NAMES[port] for port in range(NUMBER_OF_PORTS)])
+    lines.append(END_MARK % name)
+    return "\n".join(lines)
+
+
+def pin_bits(mask):
+    """Widen a pin mask to the PMCx fields of the same pins."""
+    return sum(0xF << (pin * 4) for pin in range(PINS_PER_PORT) if mask & (1 << pin))
+
+
+def build_switch(source, target):
+    """Register updates turning the images source into the images target, as (port, offset, mask, value)."""
+    deltas = []
+    for port in range(NUMBER_OF_PORTS):
+        old, new = source[port], target[port]
+        commit = new["Commit"] & ~old["Commit"]
+        if commit:
+            deltas.append((port, "PORT_LOCK_REG_OFFSET", 0xFFFFFFFF, "PORT_LOCK_KEY"))
+            deltas.append((port, "PORT_COMMIT_REG_OFFSET", commit, commit))
+        # Pins only the target owns have an unknown state, the ones both sets own are written where they differ
+        for field, offset, mask_field in SWITCH_REGISTERS:
+            changed = new["Mask"] & (~old["Mask"] | (old[field] ^ new[field]))
+            if field == "Pctl":
+                changed = pin_bits(new["Mask"] & ~old["Mask"]) | (new["Pctl_Mask"] & (old["Pctl"] ^ new["Pctl"]))
+            elif field == "Data":
+                changed &= new["Dir"]     # the level of an input pin does not matter
+            if not changed:
+                continue
+            if offset is None:
+                deltas.append((port, "PORT_DATA_MASKED_ADDRESS(0U, 0x%02XU)" % changed, 0xFFFFFFFF, new[field] & changed))
+            else:
+                deltas.append((port, offset, changed, new[field] & changed))
+        deltas += build_irq_switch(port, old, new)
+    return deltas
+
+
+def build_irq_switch(port, old, new):
+    """Interrupt updates of one port: disarm the armed pins changing sense, write the sense, then arm."""
+    deltas = []
+    unknown = new["Mask"] & ~old["Mask"]
+    sense = 0
+    for field, _ in SWITCH_IRQ_REGISTERS:
+        sense |= new["Mask"] & (unknown | (old[field] ^ new[field]))
+    if sense & old["Im"]:
+        deltas.append((port, "PORT_INT_MASK_REG_OFFSET", sense & old["Im"], 0))
+    for field, offset in SWITCH_IRQ_REGISTERS:
+        changed = new["Mask"] & (unknown | (old[field] ^ new[field]))
+        if changed:
+            deltas.append((port, offset, changed, new[field] & changed))
+    armed = new["Mask"] & (unknown | (old["Im"] ^ new["Im"]) | (sense & old["Im"]))
+    if armed & new["Im"]:
+        # Edges latched before the new sense was written must not fire
+        deltas.append((port, "PORT_INT_CLEAR_REG_OFFSET", 0xFFFFFFFF, armed & new["Im"]))
+    if armed:
+        deltas.append((port, "PORT_INT_MASK_REG_OFFSET", armed, new["Im"] & armed))
+    return deltas
+
+
+def render_switches(sets, footprint):
+    """Delta tables of every ordered pair of configuration sets and the Port_ConfigSwitches table."""
+    lines = [BEGIN_MARK % SWITCHES_REGION,
+             "  /* Generated by tools/Port_Generator.py - do not edit */"]
+    entries = []
+    for source_name, source in sets:
+        for target_name, target in sets:
+            if source_name == target_name:
+                continue
+            deltas = build_switch(source, target)
+            footprint["Deltas"] += len(deltas)
+            table = "NULL_PTR"
+            if deltas:
+                table = "%s_To_%s" % (source_name, target_name.replace("Port_", ""))
+                lines.append("/* %s -> %s { Mask, Value, Offset, Port_Num } */" % (source_name, target_name))
+                lines.append("STATIC const Port_RegDeltaType %s[%d] =" % (table, len(deltas)))
+                lines.append("{")
+                for idx, (port, offset, mask, value) in enumerate(deltas):
+                    value = value if isinstance(value, str) else "0x%08XU" % value
+                    lines.append("  { 0x%08XU, %s, %s, PORT_PORT%s }%s"
+                                 % (mask, value, offset, PORT_NAMES[port], "," if idx < len(deltas) - 1 else ""))
+                lines.append("};")
+                lines.append("")
+            entries.append("  { &%s, &%s, %s, %dU }," % (source_name, target_name, table, len(deltas)))
+    lines.append("/* Precomputed switches between the configuration sets { From, To, Delta, Count } */")
+    lines.append("const Port_ConfigSwitchType Port_ConfigSwitches[%d] =" % (len(entries) + 1))
+    lines.append("{")
+    lines += entries
+    lines.append("  { NULL_PTR, NULL_PTR, NULL_PTR, 0U }")
+    lines.append("};")
+    lines.append(END_MARK % SWITCHES_REGION)
+    return "\n".join(lines)
+
+
+def struct_layouts(symbols):
+    """Size and alignment of the Port.h types, following the Cortex-M4 EABI with int sized enums."""
+    with open(os.path.join(REPO_DIR, "Port.h")) as f:
+        text = strip_comments(f.read())
+    layouts = {"uint8": (1, 1), "uint16": (2, 2), "uint32": (4, 4), "uint64": (8, 8), "boolean": (1, 1)}
+    for base, name in re.findall(r"typedef\s+(\w+)\s+(\w+)\s*;", text):
+        layouts[name] = layouts[base]
+    for name in re.findall(r"typedef\s+enum\s*\{.*?\}\s*(\w+)\s*;", text, flags=re.S):
+        layouts[name] = (4, 4)
+    members = {}
+    for body, name in re.findall(r"typedef\s+struct\s*\{(.*?)\}\s*(\w+)\s*;", text, flags=re.S):
+        size, align, members[name] = 0, 1, []
+        for mtype, pointer, mname, dim in re.findall(r"(\w+)\s*(\*?)\s*(\w+)\s*(?:\[\s*(\w+)\s*\])?\s*;", body):
+            msize, malign = (POINTER_SIZE, POINTER_SIZE) if pointer else layouts[mtype]
+            count = evaluate(dim, symbols) if dim else 1
+            size = (size + malign - 1) // malign * malign
+            members[name].append((mname, msize * count))
+            size += msize * count
+            align = max(align, malign)
+        layouts[name] = ((size + align - 1) // align * align, align)
+    return layouts, members
+
+
+def size_report(symbols, footprints):
+    layouts, members = struct_layouts(symbols)
+    print("Port_ConfigType: %d bytes" % layouts["Port_ConfigType"][0])
+    width = max(len(mname) for mname, _ in members["Port_ConfigType"])
+    for mname, msize in members["Port_ConfigType"]:
+        print("  %-*s %5d bytes" % (width, mname, msize))
+    # Whole configuration: the sets, their switch tables (terminator included) and the notification table
+    original = symbols["PORT_CONFIGURED_PINS"] * ORIGINAL_PIN_CONFIG_SIZE
+    notifications = NUMBER_OF_PORTS * PINS_PER_PORT * POINTER_SIZE
+    for path, footprint in footprints:
+        sets = footprint["Sets"] * layouts["Port_ConfigType"][0]
+        switches = (footprint["Deltas"] * layouts["Port_RegDeltaType"][0]
+                    + (footprint["Sets"] * (footprint["Sets"] - 1) + 1) * layouts["Port_ConfigSwitchType"][0])
+        print("%s: %d bytes (%d sets %d, switches %d, notifications %d), original driver %d bytes (1 set)"
+              % (os.path.relpath(path, REPO_DIR), sets + switches + notifications, footprint["Sets"], sets,
+                 switches, notifications, original))
+
+
+def parse_overrides(argv):
+    """Return the {name: value} of every -DNAME=VALUE argument."""
+    overrides = {}
+    for arg in argv:
+        match = re.match(r"-D(\w+)=(\w+)$", arg)
+        if arg.startswith("-D") and not match:
+            raise GeneratorError("malformed option '%s', expected -DNAME=VALUE" % arg)
+        if match:
+            overrides[match.group(1)] = int(match.group(2).rstrip("uU"), 0)
+    return overrides
+
+
+def generate(path, check, symbols, mux, footprints):
+    with open(path) as f:
+        text = f.read()
+    new_text = text
+    errors = []
+    sets = []
+    for name, pins in parse_config_sets(text, symbols):
+        images = build_images(name, pins, symbols, mux)
+        errors += verify_images(name, pins, images, symbols, mux)
+        critical = build_critical(pins, images)
+        debounce = build_debounce(name, pins, symbols)
+        errors += verify_debounce(name, pins, images, debounce, symbols)
+        sleep = build_sleep(name, pins, symbols)
+        errors += verify_sleep(name, pins, images, sleep, symbols)
+        generated = render(name, pins, images, build_pin_descs(pins), build_groups(images), critical, debounce, sleep)
+        new_text = replace_region(new_text, name, generated, path)
+        sets.append((name, images))
+    footprint = {"Sets": len(sets), "Deltas": 0}
+    new_text = replace_region(new_text, SWITCHES_REGION, render_switches(sets, footprint), path)
+    footprints.append((path, footprint))
+    if errors:
+        raise GeneratorError("\n".join(errors))
+    return write_if_changed(path, text, new_text, check)
+
+
+def main(argv):
+    check = "--check" in argv
+    paths = [arg for arg in argv if not arg.startswith("-")] or [os.path.join(REPO_DIR, "Port_PBcfg.c")]
+    try:
+        symbols = load_symbols("Std_Types.h", "Port_Cfg.h", "Port.h")
+        symbols.update(parse_overrides(argv))
+        mux = load_pinmux(symbols)
+        footprints = []
+        ok = all([generate_pinmux(check, symbols, mux)] + [generate(path, check, symbols, mux, footprints) for path in paths])
+        if "--size" in argv:
+            size_report(symbols, footprints)
+    except GeneratorError as error:
+        print("Port_Generator: %s" % error, file=sys.stderr)
+        return 2
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
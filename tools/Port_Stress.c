@@ -0,0 +1,190 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Stress.c
+ *
+ * Description: Host stress test of the reentrant pin updates. One thread per
+ *              changeable pin of one port (port A by default, -DPORT_STRESS_PORT)
+ *              keeps changing the direction and the mode of its own pin with
+ *              Port_SetPinDirection, Port_SetPinDirections, Port_SetPinMode and
+ *              Port_SetPinModes, and checks after every call that the simulated
+ *              registers hold what it wrote. The other threads never touch that
+ *              pin, so any difference is an update lost by a read-modify-write
+ *              of another thread. The simulation switches threads inside the
+ *              register and the shadow read-modify-writes.
+ *
+ *              gcc -O2 -std=c99 -pthread -DPORT_HOST_SIMULATION=STD_ON -DPORT_LOCK_FREE_UPDATES=STD_ON
+ *                  -I. Port.c Port_PinMux.c Port_PBcfg.c Port_Sim.c tools/Port_Stress.c -o Port_Stress
+ *
+ *              With PORT_LOCK_FREE_UPDATES the run fails on any lost update, a
+ *              development error or a shadow drift. Built with
+ *              -DPORT_LOCK_FREE_UPDATES=STD_OFF it is the negative control of the
+ *              plain read-modify-writes and fails if it loses no update, with or
+ *              without -DPORT_SHADOW_REGISTERS=STD_OFF.
+ *
+ * Author: Ahmed Wael
+ ******************************************************************************/
+
+#include <pthread.h>
+#include <stdio.h>
+
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Port_PinMux.h"
+
+#if (PORT_HOST_SIMULATION != STD_ON)
+#error "Port_Stress.c needs PORT_HOST_SIMULATION set to STD_ON"
+#endif
+
+#ifndef PORT_STRESS_PORT
+#define PORT_STRESS_PORT                  PORT_PORTA
+#endif
+
+/* Updates done by every thread */
+#ifndef PORT_STRESS_ITERATIONS
+#define PORT_STRESS_ITERATIONS            (20000U)
+#endif
+
+/* Register and exclusive accesses between two forced thread switches */
+#ifndef PORT_STRESS_PREEMPT_PERIOD
+#define PORT_STRESS_PREEMPT_PERIOD        (3U)
+#endif
+
+STATIC uint32 Port_Stress_DetErrors = 0;
+
+Std_ReturnType Det_ReportError( uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId )
+{
+  printf("DET module %u instance %u API 0x%02X error 0x%02X\n", ModuleId, InstanceId, ApiId, ErrorId);
+  (void)__atomic_fetch_add(&Port_Stress_DetErrors, 1U, __ATOMIC_RELAXED);
+  return E_OK;
+}
+
+/* One pin hammered by one thread */
+typedef struct
+{
+  pthread_t Thread;
+  Port_PinType Pin;
+  Port_PinModeType Alt_Mode;    /* alternate mode toggled with GPIO, PORT_PIN_MODE_GPIO if the pin has none */
+  uint32 Lost;                  /* updates of this pin not found in the registers */
+
+}Port_Stress_PinType;
+
+/* Checks that the registers hold the direction and mode last written to the pin */
+STATIC uint32 Port_Stress_Check( const Port_Stress_PinType * Stress, uint8 Direction, Port_PinModeType Mode )
+{
+  const Port_PinDescType * Pin_Desc = &Port_PinConfiguration.Pin_Desc[Stress->Pin];
+  uint32 Pctl = (uint32)(PORT_PINMUX_ENTRY(PORT_STRESS_PORT, PORT_PIN_CFG_PIN_NUM(Port_PinConfiguration.Pin[Stress->Pin]), Mode) & PORT_PINMUX_PCTL_MASK);
+  uint32 Base = Port_PinConfiguration.Group[PORT_STRESS_PORT].Data_Address & ~(uint32)PORT_DATA_REG_OFFSET;   /* the pin select bits of the group address removed */
+  uint32 Dir = PORT_READ_REG(Base + PORT_DIR_REG_OFFSET) & Pin_Desc->Mask;
+  uint32 Afsel = PORT_READ_REG(Base + PORT_ALT_FUNC_REG_OFFSET) & Pin_Desc->Mask;
+  uint32 Pmc = (PORT_READ_REG(Base + PORT_CTL_REG_OFFSET) >> Pin_Desc->Pctl_Shift) & 0x0FU;
+
+  return ( (Dir != ((Direction == PORT_PIN_OUT) ? Pin_Desc->Mask : 0U))
+        || (Afsel != ((Mode == PORT_PIN_MODE_GPIO) ? 0U : Pin_Desc->Mask))
+        || (Pmc != ((Mode == PORT_PIN_MODE_GPIO) ? 0U : Pctl)) ) ? 1U : 0U;
+}
+
+STATIC void * Port_Stress_Thread( void * Argument )
+{
+  Port_Stress_PinType * Stress = (Port_Stress_PinType *)Argument;
+
+  for(uint32 Iteration = 0; Iteration < PORT_STRESS_ITERATIONS; Iteration++)
+  {
+    uint8 Direction = (Iteration & 1U) ? PORT_PIN_OUT : PORT_PIN_IN;
+    Port_PinModeType Mode = (Iteration & 2U) ? Stress->Alt_Mode : PORT_PIN_MODE_GPIO;
+
+    /* Single pin and group APIs on alternate iterations */
+    if(Iteration & 4U)
+    {
+      Port_SetPinDirections(&Stress->Pin, 1U, (Port_PinDirectionType)Direction);
+      Port_SetPinModes(&Stress->Pin, 1U, Mode);
+    }
+    else
+    {
+      Port_SetPinDirection(Stress->Pin, (Port_PinDirectionType)Direction);
+      Port_SetPinMode(Stress->Pin, Mode);
+    }
+    Stress->Lost += Port_Stress_Check(Stress, Direction, Mode);
+  }
+  return NULL;
+}
+
+int main( void )
+{
+  const Port_ConfigType * Config = &Port_PinConfiguration;
+  Port_Stress_PinType Stress[8];
+  uint8 Count = 0;
+  uint32 Lost = 0;
+
+  Port_Sim_Reset();
+  Port_Init(Config);
+  
+  /* Switch threads inside the read-modify-writes as often as interrupts could */
+  Port_Sim_SetPreemption(PORT_STRESS_PREEMPT_PERIOD);
+
+  for(Port_PinType Pin = 0; Pin < PORT_CONFIGURED_PINS; Pin++)
+  {
+    if( (PORT_PIN_CFG_PORT_NUM(Config->Pin[Pin]) == PORT_STRESS_PORT)
+     && (PORT_PIN_CFG_CHANGE_DIRECTION(Config->Pin[Pin]) == Change)
+     && (PORT_PIN_CFG_CHANGE_MODE(Config->Pin[Pin]) == Change)
+     && ((Config->Port[PORT_STRESS_PORT].Mask & Config->Pin_Desc[Pin].Mask) != 0U) )
+    {
+      Stress[Count].Pin = Pin;
+      Stress[Count].Alt_Mode = PORT_PIN_MODE_GPIO;
+      Stress[Count].Lost = 0;
+
+      /* First alternate function of the pin, its PMCx field then changes as well */
+      for(Port_PinModeType Mode = PORT_PIN_MODE_ALT1; Mode <= PORT_PIN_MODE_ALT9; Mode++)
+      {
+        if(PORT_PINMUX_ENTRY(PORT_STRESS_PORT, PORT_PIN_CFG_PIN_NUM(Config->Pin[Pin]), Mode) & PORT_PINMUX_VALID)
+        {
+          Stress[Count].Alt_Mode = Mode;
+          break;
+        }
+      }
+      Count++;
+    }
+  }
+
+  for(uint8 idx = 0; idx < Count; idx++)
+  {
+    if(pthread_create(&Stress[idx].Thread, NULL, Port_Stress_Thread, &Stress[idx]) != 0)
+    {
+      printf("Cannot create thread %u\n", idx);
+      return 1;
+    }
+  }
+  for(uint8 idx = 0; idx < Count; idx++)
+  {
+    (void)pthread_join(Stress[idx].Thread, NULL);
+    printf("Pin %u: %lu lost updates\n", Stress[idx].Pin, (unsigned long)Stress[idx].Lost);
+    Lost += Stress[idx].Lost;
+  }
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+  {
+    uint8 Drift[PORT_NUMBER_OF_PORTS];
+
+    if(Port_CheckShadow(Drift) != E_OK)
+    {
+      printf("Shadow drift on port %u: 0x%02X\n", PORT_STRESS_PORT, Drift[PORT_STRESS_PORT]);
+      Lost++;
+    }
+  }
+#endif
+
+  printf("%u threads x %lu updates: %lu lost updates, %lu development errors\n", Count,
+         (unsigned long)PORT_STRESS_ITERATIONS, (unsigned long)Lost, (unsigned long)Port_Stress_DetErrors);
+
+#if (PORT_LOCK_FREE_UPDATES == STD_ON)
+  return ((Count == 0) || (Lost != 0) || (Port_Stress_DetErrors != 0)) ? 1 : 0;
+#else
+  /* Negative control: the plain read-modify-writes must lose updates, or the run does not reach the race */
+  if(Lost == 0)
+  {
+    printf("Negative control failed: no update lost without PORT_LOCK_FREE_UPDATES\n");
+  }
+  return ((Count == 0) || (Lost == 0) || (Port_Stress_DetErrors != 0)) ? 1 : 0;
+#endif
+}